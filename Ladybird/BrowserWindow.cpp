@@ -172,6 +172,12 @@ BrowserWindow::BrowserWindow(Browser::CookieJar& cookie_jar, StringView webdrive
         debug_request("dump-local-storage");
     });
 
+    auto* dump_performance_counters_action = new QAction("Dump Performance Counters", this);
+    debug_menu->addAction(dump_performance_counters_action);
+    QObject::connect(dump_performance_counters_action, &QAction::triggered, this, [this] {
+        debug_request("dump-performance-counters");
+    });
+
     debug_menu->addSeparator();
 
     auto* show_line_box_borders_action = new QAction("Show Line Box Borders", this);
@@ -37,6 +37,7 @@ static bool is_platform_object(Type const& type)
         "NamedNodeMap"sv,
         "Node"sv,
         "Path2D"sv,
+        "PerformanceEntry"sv,
         "Range"sv,
         "ReadableStream"sv,
         "Request"sv,
@@ -56,6 +57,28 @@ static bool is_platform_object(Type const& type)
     return false;
 }
 
+// FIXME: Generate this automatically somehow.
+static bool is_dom_node_interface(Interface const& interface)
+{
+    // NOTE: Like is_platform_object(), this is hand-curated. Getting it wrong for an interface that doesn't inherit
+    //       from Node is a compile error in the generated code, not a silent bug.
+    static constexpr Array types = {
+        "Attr"sv,
+        "CDATASection"sv,
+        "CharacterData"sv,
+        "Comment"sv,
+        "Document"sv,
+        "DocumentFragment"sv,
+        "DocumentType"sv,
+        "ProcessingInstruction"sv,
+        "ShadowRoot"sv,
+        "Text"sv,
+    };
+    if (interface.name.ends_with("Element"sv))
+        return true;
+    return types.span().contains_slow(interface.name);
+}
+
 static StringView sequence_storage_type_to_cpp_storage_type_name(SequenceStorageType sequence_storage_type)
 {
     switch (sequence_storage_type) {
@@ -2109,12 +2132,14 @@ using namespace Web::FileAPI;
 using namespace Web::Geometry;
 using namespace Web::HTML;
 using namespace Web::IntersectionObserver;
+using namespace Web::PerformanceTimeline;
 using namespace Web::RequestIdleCallback;
 using namespace Web::ResizeObserver;
 using namespace Web::Selection;
 using namespace Web::Streams;
 using namespace Web::UIEvents;
 using namespace Web::URL;
+using namespace Web::UserTiming;
 using namespace Web::XHR;
 using namespace Web::WebGL;
 using namespace Web::WebIDL;
@@ -2417,6 +2442,7 @@ using namespace Web::Geometry;
 using namespace Web::HTML;
 using namespace Web::IntersectionObserver;
 using namespace Web::NavigationTiming;
+using namespace Web::PerformanceTimeline;
 using namespace Web::RequestIdleCallback;
 using namespace Web::ResizeObserver;
 using namespace Web::Selection;
@@ -2424,6 +2450,7 @@ using namespace Web::Streams;
 using namespace Web::SVG;
 using namespace Web::UIEvents;
 using namespace Web::URL;
+using namespace Web::UserTiming;
 using namespace Web::WebSockets;
 using namespace Web::XHR;
 using namespace Web::WebGL;
@@ -2603,13 +2630,28 @@ static JS::ThrowCompletionOr<@fully_qualified_name@*> impl_from(JS::VM& vm)
 )~~~");
         }
 
-        generator.append(R"~~~(
+        if (is_dom_node_interface(interface)) {
+            // NOTE: Checking for a DOM node first lets the type checks below use Node::fast_is() instead of a dynamic_cast.
+            generator.append(R"~~~(
+    if (!is<DOM::Node>(this_object))
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@fully_qualified_name@");
+
+    auto& node = static_cast<DOM::Node&>(*this_object);
+    if (!is<@fully_qualified_name@>(node))
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@fully_qualified_name@");
+
+    return static_cast<@fully_qualified_name@*>(&node);
+}
+)~~~");
+        } else {
+            generator.append(R"~~~(
     if (!is<@fully_qualified_name@>(this_object))
         return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@fully_qualified_name@");
 
     return static_cast<@fully_qualified_name@*>(this_object);
 }
 )~~~");
+        }
     }
 
     for (auto& attribute : interface.attributes) {
@@ -374,6 +374,9 @@ void BrowserWindow::build_menus()
     debug_menu.add_action(GUI::Action::create("Dump Loc&al Storage", g_icon_bag.local_storage, [this](auto&) {
         active_tab().view().debug_request("dump-local-storage");
     }));
+    debug_menu.add_action(GUI::Action::create("Dump &Performance Counters", [this](auto&) {
+        active_tab().view().debug_request("dump-performance-counters");
+    }));
     debug_menu.add_separator();
     auto line_box_borders_action = GUI::Action::create_checkable(
         "Line &Box Borders", [this](auto& action) {
@@ -47,14 +47,27 @@ void Typeface::add_bitmap_font(RefPtr<BitmapFont> font)
 void Typeface::set_vector_font(RefPtr<VectorFont> font)
 {
     m_vector_font = move(font);
+    m_scaled_fonts.clear();
 }
 
 RefPtr<Font> Typeface::get_font(float point_size, Font::AllowInexactSizeMatch allow_inexact_size_match) const
 {
     VERIFY(point_size > 0);
 
-    if (m_vector_font)
-        return adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+    if (m_vector_font) {
+        if (auto it = m_scaled_fonts.find(point_size); it != m_scaled_fonts.end())
+            return it->value;
+
+        // FIXME: It might be nicer to have a global cap on the number of fonts we cache
+        //        instead of doing it at the per-typeface level like this.
+        constexpr size_t max_cached_font_size_count = 64;
+        if (m_scaled_fonts.size() > max_cached_font_size_count)
+            m_scaled_fonts.remove(m_scaled_fonts.begin());
+
+        auto font = adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+        m_scaled_fonts.set(point_size, font);
+        return font;
+    }
 
     RefPtr<BitmapFont> best_match;
     int size = roundf(point_size);
@@ -8,6 +8,7 @@
 
 #include <AK/FlyString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibGfx/Font/BitmapFont.h>
@@ -44,6 +45,9 @@ private:
 
     Vector<RefPtr<BitmapFont>> m_bitmap_fonts;
     RefPtr<VectorFont> m_vector_font;
+
+    // NOTE: Scaled fonts keep their own glyph caches, so we hand out the same instance for every request of a given size.
+    mutable HashMap<float, NonnullRefPtr<Font>> m_scaled_fonts;
 };
 
 }
@@ -3542,9 +3542,16 @@ Completion RegExpLiteral::execute(Interpreter& interpreter) const
     auto flags = this->flags();
 
     // 3. Return ! RegExpCreate(pattern, flags).
-    Regex<ECMA262> regex(parsed_regex(), parsed_pattern(), parsed_flags());
+    // NOTE: The compiled pattern is shared with earlier RegExps of the same source text and flags if possible.
+    auto& compile_cache = vm.regexp_compile_cache();
+    auto regex = compile_cache.get(pattern, flags);
+    if (!regex.has_value()) {
+        Regex<ECMA262> compiled_regex(parsed_regex(), parsed_pattern(), parsed_flags());
+        compile_cache.set(pattern, flags, compiled_regex);
+        regex = move(compiled_regex);
+    }
     // NOTE: We bypass RegExpCreate and subsequently RegExpAlloc as an optimization to use the already parsed values.
-    auto regexp_object = RegExpObject::create(realm, move(regex), move(pattern), move(flags));
+    auto regexp_object = RegExpObject::create(realm, regex.release_value(), move(pattern), move(flags));
     // RegExpAlloc has these two steps from the 'Legacy RegExp features' proposal.
     regexp_object->set_realm(*vm.current_realm());
     // We don't need to check 'If SameValue(newTarget, thisRealm.[[Intrinsics]].[[%RegExp%]]) is true'
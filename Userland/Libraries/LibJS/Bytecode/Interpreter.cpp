@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Interpreter.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -20,6 +21,10 @@ namespace JS::Bytecode {
 static Interpreter* s_current;
 bool g_dump_bytecode = false;
 
+// Register frames are bump-allocated from this contiguous stack. Frames that don't fit
+// (e.g. very deep recursion) fall back to a heap-allocated MarkedVector.
+static constexpr size_t register_stack_size = 512 * KiB / sizeof(Value);
+
 Interpreter* Interpreter::current()
 {
     return s_current;
@@ -28,6 +33,7 @@ Interpreter* Interpreter::current()
 Interpreter::Interpreter(Realm& realm)
     : m_vm(realm.vm())
     , m_realm(realm)
+    , m_register_stack(FixedArray<Value>::must_create_but_fixme_should_propagate_errors(register_stack_size))
 {
     VERIFY(!s_current);
     s_current = this;
@@ -39,7 +45,24 @@ Interpreter::~Interpreter()
     s_current = nullptr;
 }
 
-Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& executable, BasicBlock const* entry_point, RegisterWindow* in_frame)
+void Interpreter::gather_roots(HashTable<Cell*>& roots)
+{
+    // All live frames' registers on the register stack are scanned as one contiguous range.
+    for (auto& value : m_register_stack.span().trim(m_register_stack_top)) {
+        if (value.is_cell())
+            roots.set(&value.as_cell());
+    }
+
+    // NOTE: Registers that live outside the register stack are owned by a MarkedVector, which roots them already.
+    for (auto* call_frame : m_call_frames) {
+        for (auto* environment : call_frame->saved_lexical_environments)
+            roots.set(environment);
+        for (auto* environment : call_frame->saved_variable_environments)
+            roots.set(environment);
+    }
+}
+
+Interpreter::ValueAndFrame Interpreter::run_impl(Executable const& executable, BasicBlock const* entry_point, RegisterWindow* in_frame, ReturnFrame return_frame)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
 
@@ -63,12 +86,27 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
 
     TemporaryChange restore_current_block { m_current_block, entry_point ?: &executable.basic_blocks.first() };
 
-    if (in_frame)
-        m_register_windows.append(in_frame);
-    else
-        m_register_windows.append(make<RegisterWindow>(MarkedVector<Value>(vm().heap()), MarkedVector<Environment*>(vm().heap()), MarkedVector<Environment*>(vm().heap()), Vector<UnwindInfo> {}));
+    CallFrame frame;
+    Optional<MarkedVector<Value>> overflow_registers;
+    size_t const saved_register_stack_top = m_register_stack_top;
+
+    if (in_frame) {
+        in_frame->registers.resize(executable.number_of_registers);
+        frame.registers = in_frame->registers.span();
+        swap(frame.saved_lexical_environments, static_cast<Vector<Environment*>&>(in_frame->saved_lexical_environments));
+        swap(frame.saved_variable_environments, static_cast<Vector<Environment*>&>(in_frame->saved_variable_environments));
+        swap(frame.unwind_contexts, in_frame->unwind_contexts);
+    } else if (m_register_stack_top + executable.number_of_registers <= m_register_stack.size()) {
+        frame.registers = m_register_stack.span().slice(m_register_stack_top, executable.number_of_registers);
+        frame.registers.fill({});
+        m_register_stack_top += executable.number_of_registers;
+    } else {
+        overflow_registers.emplace(vm().heap());
+        overflow_registers->resize(executable.number_of_registers);
+        frame.registers = overflow_registers->span();
+    }
 
-    registers().resize(executable.number_of_registers);
+    m_call_frames.append(&frame);
 
     for (;;) {
         Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
@@ -77,6 +115,9 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
         bool will_jump = false;
         bool will_return = false;
         while (!pc.at_end()) {
+            if (auto* sampling_profiler = vm().sampling_profiler()) [[unlikely]]
+                sampling_profiler->did_execute_instruction(*this);
+
             auto& instruction = *pc;
             auto ran_or_error = instruction.execute(*this);
             if (ran_or_error.is_error()) {
@@ -154,7 +195,21 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
         }
     }
 
-    auto frame = m_register_windows.take_last();
+    OwnPtr<RegisterWindow> frame_to_return;
+    if (in_frame) {
+        swap(frame.saved_lexical_environments, static_cast<Vector<Environment*>&>(in_frame->saved_lexical_environments));
+        swap(frame.saved_variable_environments, static_cast<Vector<Environment*>&>(in_frame->saved_variable_environments));
+        swap(frame.unwind_contexts, in_frame->unwind_contexts);
+    } else if (return_frame == ReturnFrame::Yes) {
+        frame_to_return = make<RegisterWindow>(MarkedVector<Value>(vm().heap()), MarkedVector<Environment*, 0>(vm().heap()), MarkedVector<Environment*, 0>(vm().heap()), Vector<UnwindInfo> {});
+        frame_to_return->registers.append(frame.registers.data(), frame.registers.size());
+        frame_to_return->saved_lexical_environments.extend(move(frame.saved_lexical_environments));
+        frame_to_return->saved_variable_environments.extend(move(frame.saved_variable_environments));
+        frame_to_return->unwind_contexts = move(frame.unwind_contexts);
+    }
+
+    m_call_frames.take_last();
+    m_register_stack_top = saved_register_stack_top;
 
     Value return_value = js_undefined();
     if (!m_return_value.is_empty()) {
@@ -166,8 +221,8 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
     }
 
     // NOTE: The return value from a called function is put into $0 in the caller context.
-    if (!m_register_windows.is_empty())
-        window().registers[0] = return_value;
+    if (!m_call_frames.is_empty())
+        call_frame().registers[0] = return_value;
 
     // At this point we may have already run any queued promise jobs via on_call_stack_emptied,
     // in which case this is a no-op.
@@ -183,14 +238,10 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Executable const& e
     if (!m_saved_exception.is_null()) {
         Value thrown_value = m_saved_exception.value();
         m_saved_exception = {};
-        if (auto* register_window = frame.get_pointer<NonnullOwnPtr<RegisterWindow>>())
-            return { throw_completion(thrown_value), move(*register_window) };
-        return { throw_completion(thrown_value), nullptr };
+        return { throw_completion(thrown_value), move(frame_to_return) };
     }
 
-    if (auto* register_window = frame.get_pointer<NonnullOwnPtr<RegisterWindow>>())
-        return { return_value, move(*register_window) };
-    return { return_value, nullptr };
+    return { return_value, move(frame_to_return) };
 }
 
 void Interpreter::enter_unwind_context(Optional<Label> handler_target, Optional<Label> finalizer_target)
@@ -8,6 +8,8 @@
 
 #include "Generator.h"
 #include "PassManager.h"
+#include <AK/FixedArray.h>
+#include <AK/Span.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Forward.h>
@@ -20,8 +22,18 @@ namespace JS::Bytecode {
 
 struct RegisterWindow {
     MarkedVector<Value> registers;
-    MarkedVector<Environment*> saved_lexical_environments;
-    MarkedVector<Environment*> saved_variable_environments;
+    MarkedVector<Environment*, 0> saved_lexical_environments;
+    MarkedVector<Environment*, 0> saved_variable_environments;
+    Vector<UnwindInfo> unwind_contexts;
+};
+
+// A CallFrame lives on the native stack for the duration of a single run of an executable.
+// Its registers are bump-allocated from the interpreter's register stack, or borrowed from
+// a suspended generator's RegisterWindow when resuming one.
+struct CallFrame {
+    Span<Value> registers;
+    Vector<Environment*> saved_lexical_environments;
+    Vector<Environment*> saved_variable_environments;
     Vector<UnwindInfo> unwind_contexts;
 };
 
@@ -38,7 +50,7 @@ public:
 
     ThrowCompletionOr<Value> run(Bytecode::Executable const& executable, Bytecode::BasicBlock const* entry_point = nullptr)
     {
-        auto value_and_frame = run_and_return_frame(executable, entry_point);
+        auto value_and_frame = run_impl(executable, entry_point, nullptr, ReturnFrame::No);
         return move(value_and_frame.value);
     }
 
@@ -46,14 +58,20 @@ public:
         ThrowCompletionOr<Value> value;
         OwnPtr<RegisterWindow> frame;
     };
-    ValueAndFrame run_and_return_frame(Bytecode::Executable const&, Bytecode::BasicBlock const* entry_point, RegisterWindow* = nullptr);
+
+    // NOTE: Unless an existing frame is passed in, this copies the registers out of the register stack
+    //       into a heap-allocated RegisterWindow. Use run() when the frame isn't needed afterwards.
+    ValueAndFrame run_and_return_frame(Bytecode::Executable const& executable, Bytecode::BasicBlock const* entry_point, RegisterWindow* in_frame = nullptr)
+    {
+        return run_impl(executable, entry_point, in_frame, ReturnFrame::Yes);
+    }
 
     ALWAYS_INLINE Value& accumulator() { return reg(Register::accumulator()); }
     Value& reg(Register const& r) { return registers()[r.index()]; }
 
-    auto& saved_lexical_environment_stack() { return window().saved_lexical_environments; }
-    auto& saved_variable_environment_stack() { return window().saved_variable_environments; }
-    auto& unwind_contexts() { return window().unwind_contexts; }
+    auto& saved_lexical_environment_stack() { return call_frame().saved_lexical_environments; }
+    auto& saved_variable_environment_stack() { return call_frame().saved_variable_environments; }
+    auto& unwind_contexts() { return call_frame().unwind_contexts; }
 
     void jump(Label const& label)
     {
@@ -83,24 +101,27 @@ public:
 
     VM::InterpreterExecutionScope ast_interpreter_scope();
 
+    void gather_roots(HashTable<Cell*>&);
+
 private:
-    RegisterWindow& window()
-    {
-        return m_register_windows.last().visit([](auto& x) -> RegisterWindow& { return *x; });
-    }
+    enum class ReturnFrame {
+        No,
+        Yes,
+    };
+    ValueAndFrame run_impl(Bytecode::Executable const&, Bytecode::BasicBlock const* entry_point, RegisterWindow* in_frame, ReturnFrame);
 
-    RegisterWindow const& window() const
-    {
-        return const_cast<Interpreter*>(this)->window();
-    }
+    CallFrame& call_frame() { return *m_call_frames.last(); }
+    CallFrame const& call_frame() const { return *m_call_frames.last(); }
 
-    MarkedVector<Value>& registers() { return window().registers; }
+    Span<Value> registers() { return call_frame().registers; }
 
     static AK::Array<OwnPtr<PassManager>, static_cast<UnderlyingType<Interpreter::OptimizationLevel>>(Interpreter::OptimizationLevel::__Count)> s_optimization_pipelines;
 
     VM& m_vm;
     Realm& m_realm;
-    Vector<Variant<NonnullOwnPtr<RegisterWindow>, RegisterWindow*>> m_register_windows;
+    Vector<CallFrame*> m_call_frames;
+    FixedArray<Value> m_register_stack;
+    size_t m_register_stack_top { 0 };
     Optional<BasicBlock const*> m_pending_jump;
     Value m_return_value;
     Handle<Value> m_saved_return_value;
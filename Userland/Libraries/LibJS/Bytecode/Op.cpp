@@ -25,6 +25,7 @@
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 
 namespace JS::Bytecode {
@@ -841,8 +842,31 @@ void Yield::replace_references_impl(BasicBlock const& from, BasicBlock const& to
         m_continuation_label = Label { to };
 }
 
+// OPTIMIZATION: In-bounds integer indexed access on a typed array doesn't need a property key or any of the
+//               [[Get]]/[[Set]] machinery, so we read and write the underlying buffer directly.
+static TypedArrayBase* typed_array_for_fast_indexed_access(Value base, Value property, u32& index)
+{
+    if (!base.is_object() || !property.is_integral_number())
+        return nullptr;
+    auto& object = base.as_object();
+    if (!object.is_typed_array())
+        return nullptr;
+    auto& typed_array = static_cast<TypedArrayBase&>(object);
+    auto index_value = property.as_double();
+    if (typed_array.viewed_array_buffer()->is_detached() || index_value < 0 || index_value >= typed_array.array_length())
+        return nullptr;
+    index = static_cast<u32>(index_value);
+    return &typed_array;
+}
+
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
+    u32 index = 0;
+    if (auto* typed_array = typed_array_for_fast_indexed_access(interpreter.reg(m_base), interpreter.accumulator(), index)) {
+        interpreter.accumulator() = typed_array->get_element(index);
+        return {};
+    }
+
     auto& vm = interpreter.vm();
     auto* object = TRY(interpreter.reg(m_base).to_object(vm));
 
@@ -854,6 +878,19 @@ ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpre
 
 ThrowCompletionOr<void> PutByValue::execute_impl(Bytecode::Interpreter& interpreter) const
 {
+    if (m_kind == PropertyKind::KeyValue) {
+        u32 index = 0;
+        if (auto* typed_array = typed_array_for_fast_indexed_access(interpreter.reg(m_base), interpreter.reg(m_property), index)) {
+            auto value = interpreter.accumulator();
+            // NOTE: Anything that would need ToNumber()/ToBigInt() (and could therefore have side effects) takes the slow path.
+            auto is_number_array = typed_array->content_type() == TypedArrayBase::ContentType::Number;
+            if (is_number_array ? value.is_number() : value.is_bigint()) {
+                typed_array->set_element(index, value);
+                return {};
+            }
+        }
+    }
+
     auto& vm = interpreter.vm();
     auto* object = TRY(interpreter.reg(m_base).to_object(vm));
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/TypeCasts.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
+#include <LibJS/Module.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Script.h>
+
+namespace JS::Bytecode {
+
+SamplingProfiler::SamplingProfiler(Time interval)
+    : m_interval(interval)
+    , m_start_time(Time::now_monotonic())
+    , m_next_sample_time(m_start_time + interval)
+{
+}
+
+void SamplingProfiler::stop()
+{
+    if (m_end_time.is_zero())
+        m_end_time = Time::now_monotonic();
+}
+
+void SamplingProfiler::sample_if_interval_elapsed(Interpreter& interpreter)
+{
+    // xorshift32, which is plenty random for spreading out the clock checks.
+    m_jitter_state ^= m_jitter_state << 13;
+    m_jitter_state ^= m_jitter_state >> 17;
+    m_jitter_state ^= m_jitter_state << 5;
+    m_instructions_until_clock_check = instructions_between_clock_checks / 2 + static_cast<i32>(m_jitter_state % instructions_between_clock_checks);
+
+    if (!m_end_time.is_zero())
+        return;
+
+    auto now = Time::now_monotonic();
+    if (now < m_next_sample_time)
+        return;
+
+    m_next_sample_time = now + m_interval;
+    take_sample(interpreter, now);
+}
+
+SamplingProfiler::Frame SamplingProfiler::frame_for_execution_context(ExecutionContext const& context)
+{
+    Frame frame;
+    frame.function_name = context.function_name.is_empty() ? "(anonymous)" : context.function_name;
+
+    if (auto* function = context.function) {
+        if (is<ECMAScriptFunctionObject>(*function)) {
+            auto source_range = static_cast<ECMAScriptFunctionObject const&>(*function).ecmascript_code().source_range();
+            frame.url = source_range.filename();
+            // NOTE: .cpuprofile line and column numbers are zero-based, ours are one-based.
+            frame.line_number = static_cast<i64>(source_range.start.line) - 1;
+            frame.column_number = static_cast<i64>(source_range.start.column) - 1;
+        }
+        return frame;
+    }
+
+    context.script_or_module.visit(
+        [](Empty) {},
+        [&](auto const& script_or_module) { frame.url = script_or_module->filename(); });
+    return frame;
+}
+
+void SamplingProfiler::take_sample(Interpreter& interpreter, Time timestamp)
+{
+    auto const& execution_context_stack = interpreter.vm().execution_context_stack();
+
+    Sample sample;
+    sample.timestamp = timestamp;
+    sample.frame_indices.ensure_capacity(execution_context_stack.size());
+    for (auto const* context : execution_context_stack)
+        sample.frame_indices.unchecked_append(intern_frame(frame_for_execution_context(*context)));
+    sample.bytecode_position = interpreter.debug_position();
+
+    m_samples.append(move(sample));
+}
+
+size_t SamplingProfiler::intern_frame(Frame frame)
+{
+    auto key = DeprecatedString::formatted("{}\n{}:{}:{}", frame.function_name, frame.url, frame.line_number, frame.column_number);
+    if (auto index = m_frame_indices.get(key); index.has_value())
+        return *index;
+
+    auto index = m_frames.size();
+    m_frames.append(move(frame));
+    m_frame_indices.set(move(key), index);
+    return index;
+}
+
+// https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+JsonObject SamplingProfiler::to_cpuprofile_json() const
+{
+    struct Node {
+        Optional<size_t> frame_index;
+        Vector<size_t> children;
+        size_t hit_count { 0 };
+        // NOTE: This is where the bytecode positions sampled in this node end up, keyed by executable:block:offset.
+        HashMap<DeprecatedString, size_t> bytecode_position_ticks;
+    };
+
+    // Node ids are indices into this vector plus one, the root node is always the first node.
+    Vector<Node> nodes;
+    nodes.append({});
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_timestamp = m_start_time;
+
+    for (auto const& sample : m_samples) {
+        size_t node_index = 0;
+        for (auto frame_index : sample.frame_indices) {
+            Optional<size_t> child_index;
+            for (auto index : nodes[node_index].children) {
+                if (nodes[index].frame_index == frame_index) {
+                    child_index = index;
+                    break;
+                }
+            }
+            if (!child_index.has_value()) {
+                child_index = nodes.size();
+                nodes[node_index].children.append(*child_index);
+                nodes.append({ frame_index, {}, 0, {} });
+            }
+            node_index = *child_index;
+        }
+
+        auto& leaf = nodes[node_index];
+        ++leaf.hit_count;
+        leaf.bytecode_position_ticks.ensure(sample.bytecode_position, [] { return 0; })++;
+
+        samples.append(node_index + 1);
+        time_deltas.append((sample.timestamp - previous_timestamp).to_microseconds());
+        previous_timestamp = sample.timestamp;
+    }
+
+    HashMap<DeprecatedString, size_t> script_ids;
+    JsonArray nodes_json;
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto const& node = nodes[i];
+        auto const& frame = node.frame_index.has_value() ? m_frames[*node.frame_index] : Frame { "(root)", DeprecatedString::empty(), -1, -1 };
+
+        JsonObject call_frame;
+        call_frame.set("functionName", frame.function_name);
+        call_frame.set("scriptId", DeprecatedString::number(script_ids.ensure(frame.url, [&] { return script_ids.size(); })));
+        call_frame.set("url", frame.url);
+        call_frame.set("lineNumber", frame.line_number);
+        call_frame.set("columnNumber", frame.column_number);
+
+        JsonArray children;
+        for (auto child_index : node.children)
+            children.append(child_index + 1);
+
+        JsonObject node_json;
+        node_json.set("id", i + 1);
+        node_json.set("callFrame", move(call_frame));
+        node_json.set("hitCount", node.hit_count);
+        node_json.set("children", move(children));
+
+        if (!node.bytecode_position_ticks.is_empty()) {
+            JsonArray position_ticks;
+            for (auto const& it : node.bytecode_position_ticks) {
+                JsonObject position_tick;
+                position_tick.set("position", it.key);
+                position_tick.set("ticks", it.value);
+                position_ticks.append(move(position_tick));
+            }
+            node_json.set("bytecodePositionTicks", move(position_ticks));
+        }
+
+        nodes_json.append(move(node_json));
+    }
+
+    auto end_time = m_end_time.is_zero() ? Time::now_monotonic() : m_end_time;
+
+    JsonObject profile;
+    profile.set("nodes", move(nodes_json));
+    profile.set("startTime", m_start_time.to_microseconds());
+    profile.set("endTime", end_time.to_microseconds());
+    profile.set("samples", move(samples));
+    profile.set("timeDeltas", move(time_deltas));
+    return profile;
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// A sampling profiler for the bytecode interpreter.
+// NOTE: Instead of relying on a timer signal, the interpreter ticks the profiler for every instruction it executes,
+//       and the profiler only looks at the clock once every few hundred ticks. Whenever the sampling interval has
+//       elapsed, the JS call stack is recorded, along with the bytecode position of the innermost frame.
+class SamplingProfiler {
+public:
+    explicit SamplingProfiler(Time interval);
+
+    ALWAYS_INLINE void did_execute_instruction(Interpreter& interpreter)
+    {
+        if (--m_instructions_until_clock_check > 0)
+            return;
+        sample_if_interval_elapsed(interpreter);
+    }
+
+    void stop();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // Exports the recorded samples in the .cpuprofile format understood by Chrome's and Firefox's developer tools.
+    JsonObject to_cpuprofile_json() const;
+
+private:
+    // NOTE: The distance between clock checks is jittered, as a fixed one would keep sampling the same instruction
+    //       of any loop whose length divides it.
+    static constexpr i32 instructions_between_clock_checks = 256;
+
+    struct Frame {
+        DeprecatedString function_name;
+        DeprecatedString url { DeprecatedString::empty() };
+        i64 line_number { -1 };
+        i64 column_number { -1 };
+    };
+
+    struct Sample {
+        Time timestamp;
+        Vector<size_t> frame_indices; // Outermost frame first.
+        DeprecatedString bytecode_position;
+    };
+
+    static Frame frame_for_execution_context(ExecutionContext const&);
+
+    void sample_if_interval_elapsed(Interpreter&);
+    void take_sample(Interpreter&, Time timestamp);
+    size_t intern_frame(Frame);
+
+    Time m_interval;
+    Time m_start_time;
+    Time m_end_time;
+    Time m_next_sample_time;
+    i32 m_instructions_until_clock_check { instructions_between_clock_checks };
+    u32 m_jitter_state { 0x9e3779b9 };
+
+    Vector<Frame> m_frames;
+    HashMap<DeprecatedString, size_t> m_frame_indices;
+    Vector<Sample> m_samples;
+};
+
+}
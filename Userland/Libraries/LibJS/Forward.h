@@ -189,12 +189,14 @@ struct ParserError;
 class PrimitiveString;
 class Program;
 class PromiseCapability;
+class PromiseJobClosure;
 class PromiseReaction;
 class PropertyAttributes;
 class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class RegExpCompileCache;
 class ScopeNode;
 class Script;
 class Shape;
@@ -297,6 +299,7 @@ class Generator;
 class Instruction;
 class Interpreter;
 class Register;
+class SamplingProfiler;
 }
 
 }
@@ -96,8 +96,8 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     perf_event(PERF_EVENT_SIGNPOST, gc_perf_string_id, global_gc_counter++);
 #endif
 
-    Core::ElapsedTimer collection_measurement_timer;
-    if (print_report)
+    Core::ElapsedTimer collection_measurement_timer(true);
+    if (print_report || on_garbage_collection_finished)
         collection_measurement_timer.start();
 
     if (collection_type == CollectionType::CollectGarbage) {
@@ -111,6 +111,9 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     }
     finalize_unmarked_cells();
     sweep_dead_cells(print_report, collection_measurement_timer);
+
+    if (on_garbage_collection_finished)
+        on_garbage_collection_finished(collection_measurement_timer.origin_time(), collection_measurement_timer.elapsed_time());
 }
 
 void Heap::gather_roots(HashTable<Cell*>& roots)
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Function.h>
+#include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayPrototype.h>
@@ -65,6 +66,34 @@ Array::Array(Object& prototype)
 {
 }
 
+// NON-STANDARD: Whether CreateDataPropertyOrThrow(A, index, value) can be performed by storing directly into packed storage.
+bool Array::can_store_packed_element(size_t index) const
+{
+    if (!indexed_properties().has_packed_storage() || !m_is_extensible)
+        return false;
+    if (index >= NumericLimits<i32>::max())
+        return false;
+    return index < indexed_properties().array_like_size() || m_length_writable;
+}
+
+// NON-STANDARD: Whether count elements can be appended with [[Set]] (e.g. by push()) by storing directly into packed storage.
+// NOTE: This is only unobservable if nothing on the prototype chain could intercept the [[Set]], i.e. the array inherits
+//       from %Array.prototype% and %Object.prototype%, and neither of them has any indexed properties.
+bool Array::can_append_packed_elements(Realm& realm, size_t count) const
+{
+    if (!indexed_properties().has_packed_storage() || !m_is_extensible || !m_length_writable)
+        return false;
+    if (indexed_properties().array_like_size() + count >= NumericLimits<i32>::max())
+        return false;
+
+    auto const* array_prototype = realm.intrinsics().array_prototype();
+    auto const* object_prototype = realm.intrinsics().object_prototype();
+    if (shape().prototype() != array_prototype || array_prototype->shape().prototype() != object_prototype)
+        return false;
+
+    return array_prototype->indexed_properties().is_empty() && object_prototype->indexed_properties().is_empty();
+}
+
 // 10.4.2.4 ArraySetLength ( A, Desc ), https://tc39.es/ecma262/#sec-arraysetlength
 ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_descriptor)
 {
@@ -185,11 +214,12 @@ ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, Funct
         return value_number.as_double();
     }
 
+    // NOTE: Strings don't need to be converted, so we can avoid allocating new PrimitiveStrings for them.
     // 5. Let xString be ? ToString(x).
-    auto x_string = PrimitiveString::create(vm, TRY(x.to_string(vm)));
+    auto x_string = x.is_string() ? NonnullGCPtr { x.as_string() } : PrimitiveString::create(vm, TRY(x.to_string(vm)));
 
     // 6. Let yString be ? ToString(y).
-    auto y_string = PrimitiveString::create(vm, TRY(y.to_string(vm)));
+    auto y_string = y.is_string() ? NonnullGCPtr { y.as_string() } : PrimitiveString::create(vm, TRY(y.to_string(vm)));
 
     // 7. Let xSmaller be ! IsLessThan(xString, yString, true).
     auto x_smaller = MUST(is_less_than(vm, x_string, y_string, true));
@@ -216,8 +246,18 @@ ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object co
     auto items = MarkedVector<Value> { vm.heap() };
 
     // 2. Let k be 0.
+    auto const* array = is<Array>(object) ? static_cast<Array const*>(&object) : nullptr;
+
     // 3. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
+        // NOTE: A present element in packed storage is an own data property, so HasProperty() and Get() can be skipped.
+        if (array) {
+            if (auto k_value = array->get_packed_element(k); k_value.has_value()) {
+                items.append(*k_value);
+                continue;
+            }
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
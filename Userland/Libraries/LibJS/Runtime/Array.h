@@ -44,15 +44,24 @@ public:
 
     [[nodiscard]] bool length_is_writable() const { return m_length_writable; };
 
+    Optional<Value> get_packed_element(size_t index) const { return indexed_properties().get_packed_element(index); }
+    bool can_store_packed_element(size_t index) const;
+    bool can_append_packed_elements(Realm&, size_t count) const;
+
 protected:
     explicit Array(Object& prototype);
 
 private:
     ThrowCompletionOr<bool> set_length(PropertyDescriptor const&);
 
+    virtual bool is_array_exotic_object() const final { return true; }
+
     bool m_length_writable { true };
 };
 
+template<>
+inline bool Object::fast_is<Array>() const { return is_array_exotic_object(); }
+
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, bool skip_holes);
 
@@ -80,47 +80,44 @@ ThrowCompletionOr<ArrayBuffer*> allocate_array_buffer(VM&, FunctionObject& const
 ThrowCompletionOr<void> detach_array_buffer(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
 ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM&, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length);
 
-// 25.1.2.9 RawBytesToNumeric ( type, rawBytes, isLittleEndian ), https://tc39.es/ecma262/#sec-rawbytestonumeric
+// NON-STANDARD: The conversion steps of RawBytesToNumeric, for a value that has already been read from the buffer in native byte order.
 template<typename T>
-static Value raw_bytes_to_numeric(VM& vm, ByteBuffer raw_value, bool is_little_endian)
+static Value raw_value_to_numeric(VM& vm, Conditional<IsSame<ClampedU8, T>, u8, T> value)
 {
-    if (!is_little_endian) {
-        VERIFY(raw_value.size() % 2 == 0);
-        for (size_t i = 0; i < raw_value.size() / 2; ++i)
-            swap(raw_value[i], raw_value[raw_value.size() - 1 - i]);
-    }
     using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
-    if constexpr (IsSame<UnderlyingBufferDataType, float>) {
-        float value;
-        raw_value.span().copy_to({ &value, sizeof(float) });
+    if constexpr (IsFloatingPoint<UnderlyingBufferDataType>) {
         if (isnan(value))
             return js_nan();
         return Value(value);
-    }
-    if constexpr (IsSame<UnderlyingBufferDataType, double>) {
-        double value;
-        raw_value.span().copy_to({ &value, sizeof(double) });
-        if (isnan(value))
-            return js_nan();
-        return Value(value);
-    }
-    if constexpr (!IsIntegral<UnderlyingBufferDataType>)
-        VERIFY_NOT_REACHED();
-    UnderlyingBufferDataType int_value = 0;
-    raw_value.span().copy_to({ &int_value, sizeof(UnderlyingBufferDataType) });
-    if constexpr (sizeof(UnderlyingBufferDataType) == 8) {
+    } else if constexpr (sizeof(UnderlyingBufferDataType) == 8) {
         if constexpr (IsSigned<UnderlyingBufferDataType>) {
             static_assert(IsSame<UnderlyingBufferDataType, i64>);
-            return BigInt::create(vm, Crypto::SignedBigInteger { int_value });
+            return BigInt::create(vm, Crypto::SignedBigInteger { value });
         } else {
-            static_assert(IsOneOf<UnderlyingBufferDataType, u64, double>);
-            return BigInt::create(vm, Crypto::SignedBigInteger { Crypto::UnsignedBigInteger { int_value } });
+            static_assert(IsSame<UnderlyingBufferDataType, u64>);
+            return BigInt::create(vm, Crypto::SignedBigInteger { Crypto::UnsignedBigInteger { value } });
         }
     } else {
-        return Value(int_value);
+        return Value(value);
     }
 }
 
+// 25.1.2.9 RawBytesToNumeric ( type, rawBytes, isLittleEndian ), https://tc39.es/ecma262/#sec-rawbytestonumeric
+template<typename T>
+static Value raw_bytes_to_numeric(VM& vm, ByteBuffer raw_value, bool is_little_endian)
+{
+    if (!is_little_endian) {
+        VERIFY(raw_value.size() % 2 == 0);
+        for (size_t i = 0; i < raw_value.size() / 2; ++i)
+            swap(raw_value[i], raw_value[raw_value.size() - 1 - i]);
+    }
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+    static_assert(IsIntegral<UnderlyingBufferDataType> || IsFloatingPoint<UnderlyingBufferDataType>);
+    UnderlyingBufferDataType value;
+    raw_value.span().copy_to({ &value, sizeof(UnderlyingBufferDataType) });
+    return raw_value_to_numeric<T>(vm, value);
+}
+
 // Implementation for 25.1.2.10 GetValueFromBuffer, used in TypedArray<T>::get_value_from_buffer().
 template<typename T>
 Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_array, Order, bool is_little_endian)
@@ -136,69 +133,53 @@ Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_a
     return raw_bytes_to_numeric<T>(vm, move(raw_value), is_little_endian);
 }
 
+// NON-STANDARD: The conversion steps of NumericToRawBytes, producing a value in native byte order.
+template<typename T>
+static Conditional<IsSame<ClampedU8, T>, u8, T> numeric_to_raw_value(VM& vm, Value value)
+{
+    VERIFY(value.is_number() || value.is_bigint());
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+    if constexpr (IsFloatingPoint<UnderlyingBufferDataType>) {
+        return static_cast<UnderlyingBufferDataType>(MUST(value.to_double(vm)));
+    } else if constexpr (sizeof(UnderlyingBufferDataType) == 8) {
+        if constexpr (IsSigned<UnderlyingBufferDataType>)
+            return MUST(value.to_bigint_int64(vm));
+        else
+            return MUST(value.to_bigint_uint64(vm));
+    } else if constexpr (IsSigned<UnderlyingBufferDataType>) {
+        if constexpr (sizeof(UnderlyingBufferDataType) == 4)
+            return MUST(value.to_i32(vm));
+        else if constexpr (sizeof(UnderlyingBufferDataType) == 2)
+            return MUST(value.to_i16(vm));
+        else
+            return MUST(value.to_i8(vm));
+    } else {
+        if constexpr (sizeof(UnderlyingBufferDataType) == 4)
+            return MUST(value.to_u32(vm));
+        else if constexpr (sizeof(UnderlyingBufferDataType) == 2)
+            return MUST(value.to_u16(vm));
+        else if constexpr (!IsSame<T, ClampedU8>)
+            return MUST(value.to_u8(vm));
+        else
+            return MUST(value.to_u8_clamp(vm));
+    }
+}
+
 // 25.1.2.11 NumericToRawBytes ( type, value, isLittleEndian ), https://tc39.es/ecma262/#sec-numerictorawbytes
 template<typename T>
 static ByteBuffer numeric_to_raw_bytes(VM& vm, Value value, bool is_little_endian)
 {
-    VERIFY(value.is_number() || value.is_bigint());
     using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
     ByteBuffer raw_bytes = ByteBuffer::create_uninitialized(sizeof(UnderlyingBufferDataType)).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    auto flip_if_needed = [&]() {
-        if (is_little_endian)
-            return;
-        VERIFY(sizeof(UnderlyingBufferDataType) % 2 == 0);
-        for (size_t i = 0; i < sizeof(UnderlyingBufferDataType) / 2; ++i)
-            swap(raw_bytes[i], raw_bytes[sizeof(UnderlyingBufferDataType) - 1 - i]);
-    };
-    if constexpr (IsSame<UnderlyingBufferDataType, float>) {
-        float raw_value = MUST(value.to_double(vm));
-        ReadonlyBytes { &raw_value, sizeof(float) }.copy_to(raw_bytes);
-        flip_if_needed();
-        return raw_bytes;
-    }
-    if constexpr (IsSame<UnderlyingBufferDataType, double>) {
-        double raw_value = MUST(value.to_double(vm));
-        ReadonlyBytes { &raw_value, sizeof(double) }.copy_to(raw_bytes);
-        flip_if_needed();
-        return raw_bytes;
-    }
-    if constexpr (!IsIntegral<UnderlyingBufferDataType>)
-        VERIFY_NOT_REACHED();
-    if constexpr (sizeof(UnderlyingBufferDataType) == 8) {
-        UnderlyingBufferDataType int_value;
 
-        if constexpr (IsSigned<UnderlyingBufferDataType>)
-            int_value = MUST(value.to_bigint_int64(vm));
-        else
-            int_value = MUST(value.to_bigint_uint64(vm));
+    auto raw_value = numeric_to_raw_value<T>(vm, value);
+    ReadonlyBytes { &raw_value, sizeof(UnderlyingBufferDataType) }.copy_to(raw_bytes);
 
-        ReadonlyBytes { &int_value, sizeof(UnderlyingBufferDataType) }.copy_to(raw_bytes);
-        flip_if_needed();
-        return raw_bytes;
-    } else {
-        UnderlyingBufferDataType int_value;
-        if constexpr (IsSigned<UnderlyingBufferDataType>) {
-            if constexpr (sizeof(UnderlyingBufferDataType) == 4)
-                int_value = MUST(value.to_i32(vm));
-            else if constexpr (sizeof(UnderlyingBufferDataType) == 2)
-                int_value = MUST(value.to_i16(vm));
-            else
-                int_value = MUST(value.to_i8(vm));
-        } else {
-            if constexpr (sizeof(UnderlyingBufferDataType) == 4)
-                int_value = MUST(value.to_u32(vm));
-            else if constexpr (sizeof(UnderlyingBufferDataType) == 2)
-                int_value = MUST(value.to_u16(vm));
-            else if constexpr (!IsSame<T, ClampedU8>)
-                int_value = MUST(value.to_u8(vm));
-            else
-                int_value = MUST(value.to_u8_clamp(vm));
-        }
-        ReadonlyBytes { &int_value, sizeof(UnderlyingBufferDataType) }.copy_to(raw_bytes);
-        if constexpr (sizeof(UnderlyingBufferDataType) % 2 == 0)
-            flip_if_needed();
-        return raw_bytes;
+    if (!is_little_endian && sizeof(UnderlyingBufferDataType) % 2 == 0) {
+        for (size_t i = 0; i < sizeof(UnderlyingBufferDataType) / 2; ++i)
+            swap(raw_bytes[i], raw_bytes[sizeof(UnderlyingBufferDataType) - 1 - i]);
     }
+    return raw_bytes;
 }
 
 // 25.1.2.12 SetValueInBuffer ( arrayBuffer, byteIndex, type, value, isTypedArray, order [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-setvalueinbuffer
@@ -11,6 +11,7 @@
 #include <AK/HashTable.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayConstructor.h>
@@ -148,6 +149,47 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+// NOTE: The following helpers implement fast paths for plain Arrays with packed element storage. As user code (e.g. a callback)
+//       may change the array at any point, they are checked again for every element.
+
+// Performs `kPresent = ? HasProperty(O, Pk)` and, if kPresent is true, `kValue = ? Get(O, Pk)`.
+static ThrowCompletionOr<Optional<Value>> get_element_if_present(Object& object, size_t index)
+{
+    // A present element in packed storage is an own data property, so it can be read without consulting the prototype chain.
+    if (is<Array>(object)) {
+        if (auto value = static_cast<Array&>(object).get_packed_element(index); value.has_value())
+            return value;
+    }
+
+    auto property_key = PropertyKey { index };
+    if (!TRY(object.has_property(property_key)))
+        return Optional<Value> {};
+    return TRY(object.get(property_key));
+}
+
+// Performs `? Get(O, ! ToString(𝔽(index)))`.
+static ThrowCompletionOr<Value> get_element(Object& object, size_t index)
+{
+    if (is<Array>(object)) {
+        if (auto value = static_cast<Array&>(object).get_packed_element(index); value.has_value())
+            return *value;
+    }
+
+    return object.get(index);
+}
+
+// Performs `? CreateDataPropertyOrThrow(A, ! ToString(𝔽(index)), value)`.
+static ThrowCompletionOr<void> create_data_element_or_throw(Object& object, size_t index, Value value)
+{
+    if (is<Array>(object) && static_cast<Array&>(object).can_store_packed_element(index)) {
+        object.indexed_properties().put(index, value);
+        return {};
+    }
+
+    TRY(object.create_data_property_or_throw(index, value));
+    return {};
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -322,15 +364,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::every)
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_value_if_present = TRY(get_element_if_present(*object, k));
 
         // c. If kPresent is true, then
-        if (k_present) {
+        if (k_value_if_present.has_value()) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+            auto k_value = k_value_if_present.release_value();
 
             // ii. Let testResult be ToBoolean(? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »)).
             auto test_result = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object)).to_boolean();
@@ -416,15 +456,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::filter)
     // 7. Repeat, while k < len,
     for (; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_value_if_present = TRY(get_element_if_present(*object, k));
 
         // c. If kPresent is true, then
-        if (k_present) {
+        if (k_value_if_present.has_value()) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(k));
+            auto k_value = k_value_if_present.release_value();
 
             // ii. Let selected be ToBoolean(? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »)).
             auto selected = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object)).to_boolean();
@@ -432,7 +470,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::filter)
             // iii. If selected is true, then
             if (selected) {
                 // 1. Perform ? CreateDataPropertyOrThrow(A, ! ToString(𝔽(to)), kValue).
-                TRY(array->create_data_property_or_throw(to, k_value));
+                TRY(create_data_element_or_throw(*array, to, k_value));
 
                 // 2. Set to to to + 1.
                 ++to;
@@ -701,15 +739,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_value_if_present = TRY(get_element_if_present(*object, k));
 
         // c. If kPresent is true, then
-        if (k_present) {
+        if (k_value_if_present.has_value()) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+            auto k_value = k_value_if_present.release_value();
 
             // ii. Perform ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
             TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
@@ -903,7 +939,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
     }
     auto value_to_find = vm.argument(0);
     for (u64 i = from_index; i < length; ++i) {
-        auto element = TRY(this_object->get(i));
+        auto element = TRY(get_element(*this_object, i));
         if (same_value_zero(element, value_to_find))
             return Value(true);
     }
@@ -957,15 +993,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
 
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
-        auto property_key = PropertyKey { k };
-
         // a. Let kPresent be ? HasProperty(O, ! ToString(𝔽(k))).
-        auto k_present = TRY(object->has_property(property_key));
+        auto element_k_if_present = TRY(get_element_if_present(*object, k));
 
         // b. If kPresent is true, then
-        if (k_present) {
+        if (element_k_if_present.has_value()) {
             // i. Let elementK be ? Get(O, ! ToString(𝔽(k))).
-            auto element_k = TRY(object->get(property_key));
+            auto element_k = element_k_if_present.release_value();
 
             // ii. Let same be IsStrictlyEqual(searchElement, elementK).
             auto same = is_strictly_equal(search_element, element_k);
@@ -1116,21 +1150,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
     // 6. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_value_if_present = TRY(get_element_if_present(*object, k));
 
         // c. If kPresent is true, then
-        if (k_present) {
+        if (k_value_if_present.has_value()) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+            auto k_value = k_value_if_present.release_value();
 
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
             auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
 
             // iii. Perform ? CreateDataPropertyOrThrow(A, Pk, mappedValue).
-            TRY(array->create_data_property_or_throw(property_key, mapped_value));
+            TRY(create_data_element_or_throw(*array, k, mapped_value));
         }
 
         // d. Set k to k + 1.
@@ -1165,6 +1197,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
+
+    // NOTE: If nothing could observe the [[Set]]s, we can append to the packed storage of a plain Array directly.
+    if (is<Array>(*this_object) && static_cast<Array&>(*this_object).can_append_packed_elements(*vm.current_realm(), argument_count)) {
+        for (size_t i = 0; i < argument_count; ++i)
+            this_object->indexed_properties().append(vm.argument(i));
+        return Value(new_length);
+    }
+
     for (size_t i = 0; i < argument_count; ++i)
         TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
@@ -1440,11 +1480,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::slice)
     size_t k = actual_start;
 
     while (k < final) {
-        bool present = TRY(this_object->has_property(k));
-        if (present) {
-            auto value = TRY(this_object->get(k));
-            TRY(new_array->create_data_property_or_throw(index, value));
-        }
+        auto value = TRY(get_element_if_present(*this_object, k));
+        if (value.has_value())
+            TRY(create_data_element_or_throw(*new_array, index, *value));
 
         ++k;
         ++index;
@@ -1474,15 +1512,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
-        auto property_key = PropertyKey { k };
-
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_value_if_present = TRY(get_element_if_present(*object, k));
 
         // c. If kPresent is true, then
-        if (k_present) {
+        if (k_value_if_present.has_value()) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+            auto k_value = k_value_if_present.release_value();
 
             // ii. Let testResult be ToBoolean(? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »)).
             auto test_result = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object)).to_boolean();
@@ -1585,8 +1621,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     // 8. Let j be 0.
     size_t j = 0;
 
+    auto* array = is<Array>(*object) ? static_cast<Array*>(object) : nullptr;
+
     // 9. Repeat, while j < itemCount,
     for (; j < item_count; ++j) {
+        // NOTE: Overwriting a present element in packed storage of a plain Array can't be observed, so we can skip [[Set]].
+        if (array && array->get_packed_element(j).has_value()) {
+            array->indexed_properties().put(j, sorted_list[j]);
+            continue;
+        }
+
         // a. Perform ? Set(obj, ! ToString(𝔽(j)), sortedList[j], true).
         TRY(object->set(j, sorted_list[j], Object::ShouldThrowExceptions::Yes));
         // b. Set j to j + 1.
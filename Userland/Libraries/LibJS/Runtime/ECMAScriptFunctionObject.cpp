@@ -842,6 +842,15 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
             }
         }
         TRY(function_declaration_instantiation(nullptr));
+
+        // NOTE: Running the bytecode should eventually return a completion.
+        // Until it does, we assume "return" and include the undefined fallback from the call site.
+        if (m_kind == FunctionKind::Normal) {
+            // Normal functions don't need their register frame after returning, so it can stay on the register stack.
+            auto result = TRY(bytecode_interpreter->run(*m_bytecode_executable));
+            return { Completion::Type::Return, result.value_or(js_undefined()), {} };
+        }
+
         auto result_and_frame = bytecode_interpreter->run_and_return_frame(*m_bytecode_executable, nullptr);
 
         VERIFY(result_and_frame.frame != nullptr);
@@ -850,11 +859,6 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
 
         auto result = result_and_frame.value.release_value();
 
-        // NOTE: Running the bytecode should eventually return a completion.
-        // Until it does, we assume "return" and include the undefined fallback from the call site.
-        if (m_kind == FunctionKind::Normal)
-            return { Completion::Type::Return, result.value_or(js_undefined()), {} };
-
         auto generator_object = TRY(GeneratorObject::create(realm, result, this, vm.running_execution_context().copy(), move(*result_and_frame.frame)));
 
         // NOTE: Async functions are entirely transformed to generator functions, and wrapped in a custom driver that returns a promise
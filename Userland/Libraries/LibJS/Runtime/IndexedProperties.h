@@ -124,6 +124,21 @@ public:
 
     bool has_index(u32 index) const { return m_storage ? m_storage->has_index(index) : false; }
     Optional<ValueAndAttributes> get(u32 index) const;
+
+    // Fast path accessors for packed storage, where every present element is a data property with default attributes.
+    bool has_packed_storage() const { return !m_storage || m_storage->is_simple_storage(); }
+    Optional<Value> get_packed_element(size_t index) const
+    {
+        if (!m_storage || !m_storage->is_simple_storage())
+            return {};
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        if (index >= storage.array_like_size() || index >= storage.elements().size())
+            return {};
+        auto value = storage.elements()[index];
+        if (value.is_empty())
+            return {};
+        return value;
+    }
     void put(u32 index, Value value, PropertyAttributes attributes = default_attributes);
     void remove(u32 index);
 
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
@@ -22,6 +25,7 @@
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 
 namespace JS {
@@ -388,6 +392,310 @@ DeprecatedString JSONObject::quote_json_string(DeprecatedString string)
     return builder.to_deprecated_string();
 }
 
+struct JSONKeySequenceTraits : public GenericTraits<Vector<FlyString>> {
+    static unsigned hash(Vector<FlyString> const& keys)
+    {
+        unsigned hash = 0;
+        for (auto& key : keys)
+            hash = pair_int_hash(hash, key.hash());
+        return hash;
+    }
+};
+
+// Parses JSON text directly into JS values, without going through an intermediate AK::JsonValue tree.
+// Objects with the same sequence of keys (e.g. an array of records) share a Shape, which is looked up
+// once per key sequence instead of walking the shape transition chain for every object.
+class JSONParser {
+public:
+    JSONParser(VM& vm, StringView input)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_input(input)
+        , m_lexer(input)
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        skip_whitespace();
+        if (!m_lexer.is_eof())
+            return syntax_error();
+        return value;
+    }
+
+private:
+    static constexpr bool is_json_whitespace(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    void skip_whitespace() { m_lexer.ignore_while(is_json_whitespace); }
+
+    ThrowCompletionOr<Value> syntax_error()
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        skip_whitespace();
+        switch (m_lexer.peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"': {
+            auto string = TRY(parse_string());
+            return PrimitiveString::create(m_vm, move(string));
+        }
+        case 't':
+            if (m_lexer.consume_specific("true"sv))
+                return Value(true);
+            return syntax_error();
+        case 'f':
+            if (m_lexer.consume_specific("false"sv))
+                return Value(false);
+            return syntax_error();
+        case 'n':
+            if (m_lexer.consume_specific("null"sv))
+                return js_null();
+            return syntax_error();
+        default:
+            if (m_lexer.next_is('-') || m_lexer.next_is(is_ascii_digit))
+                return parse_number();
+            return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        m_lexer.consume_specific('{');
+
+        Vector<FlyString> keys;
+        MarkedVector<Value> values { m_realm.heap() };
+
+        skip_whitespace();
+        if (!m_lexer.consume_specific('}')) {
+            for (;;) {
+                skip_whitespace();
+                if (!m_lexer.next_is('"'))
+                    return syntax_error();
+                keys.append(TRY(parse_key()));
+                skip_whitespace();
+                if (!m_lexer.consume_specific(':'))
+                    return syntax_error();
+                values.append(TRY(parse_value()));
+                skip_whitespace();
+                if (m_lexer.consume_specific('}'))
+                    break;
+                if (!m_lexer.consume_specific(','))
+                    return syntax_error();
+            }
+        }
+
+        if (auto shape = m_shape_cache.get(keys); shape.has_value()) {
+            auto object = Object::create_with_premade_shape(**shape);
+            for (size_t i = 0; i < values.size(); ++i)
+                object->put_direct(i, values[i]);
+            return object;
+        }
+
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+        for (size_t i = 0; i < keys.size(); ++i)
+            object->define_direct_property(keys[i], values[i], default_attributes);
+
+        // NOTE: If every key ended up as a distinct named property, the shape is a plain transition
+        //       from the default object shape and can be reused for the same key sequence.
+        //       The shape stays alive for the rest of the parse, as the object using it is part of the result.
+        if (!object->shape().is_unique() && object->shape().property_count() == keys.size())
+            m_shape_cache.set(move(keys), &object->shape());
+
+        return object;
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        m_lexer.consume_specific('[');
+
+        MarkedVector<Value> values { m_realm.heap() };
+
+        skip_whitespace();
+        if (!m_lexer.consume_specific(']')) {
+            for (;;) {
+                values.append(TRY(parse_value()));
+                skip_whitespace();
+                if (m_lexer.consume_specific(']'))
+                    break;
+                if (!m_lexer.consume_specific(','))
+                    return syntax_error();
+            }
+        }
+
+        auto array = MUST(Array::create(m_realm, 0));
+        if (!values.is_empty()) {
+            Vector<Value> elements;
+            elements.ensure_capacity(values.size());
+            elements.append(values.data(), values.size());
+            array->set_indexed_property_elements(move(elements));
+        }
+        return array;
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = m_lexer.tell();
+
+        bool negative = m_lexer.consume_specific('-');
+        if (!m_lexer.next_is(is_ascii_digit))
+            return syntax_error();
+
+        // NOTE: Integers of up to 15 digits are exactly representable as doubles, so we don't need the floating point parser for them.
+        u64 integer_value = 0;
+        size_t digit_count = 0;
+        if (m_lexer.consume_specific('0')) {
+            digit_count = 1;
+        } else {
+            while (m_lexer.next_is(is_ascii_digit)) {
+                integer_value = integer_value * 10 + parse_ascii_digit(m_lexer.consume());
+                ++digit_count;
+            }
+        }
+
+        bool is_integer = true;
+        if (m_lexer.consume_specific('.')) {
+            is_integer = false;
+            if (!m_lexer.next_is(is_ascii_digit))
+                return syntax_error();
+            m_lexer.ignore_while(is_ascii_digit);
+        }
+        if (m_lexer.next_is('e') || m_lexer.next_is('E')) {
+            is_integer = false;
+            m_lexer.ignore();
+            if (m_lexer.next_is('+') || m_lexer.next_is('-'))
+                m_lexer.ignore();
+            if (!m_lexer.next_is(is_ascii_digit))
+                return syntax_error();
+            m_lexer.ignore_while(is_ascii_digit);
+        }
+
+        if (is_integer && digit_count <= 15) {
+            auto value = static_cast<double>(integer_value);
+            return Value(negative ? -value : value);
+        }
+
+        auto number_view = m_input.substring_view(start, m_lexer.tell() - start);
+        auto result = parse_first_floating_point(number_view.characters_without_null_termination(), number_view.characters_without_null_termination() + number_view.length());
+        VERIFY(result.parsed_value());
+        return Value(result.value);
+    }
+
+    ThrowCompletionOr<FlyString> parse_key()
+    {
+        // Most keys don't contain escapes, so we can intern them straight from the input.
+        auto start = m_lexer.tell();
+        m_lexer.ignore();
+        auto key = m_lexer.consume_while([](char ch) { return ch != '"' && ch != '\\' && !is_ascii_c0_control(ch); });
+        if (m_lexer.consume_specific('"'))
+            return FlyString { key };
+
+        m_lexer.retreat(m_lexer.tell() - start);
+        return FlyString { TRY(parse_string()) };
+    }
+
+    ThrowCompletionOr<DeprecatedString> parse_string()
+    {
+        m_lexer.ignore();
+
+        auto chunk = m_lexer.consume_while([](char ch) { return ch != '"' && ch != '\\' && !is_ascii_c0_control(ch); });
+        if (m_lexer.consume_specific('"'))
+            return DeprecatedString { chunk };
+
+        StringBuilder builder;
+        builder.append(chunk);
+
+        for (;;) {
+            if (m_lexer.is_eof())
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            char ch = m_lexer.consume();
+            if (ch == '"')
+                break;
+            if (is_ascii_c0_control(ch))
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            if (ch != '\\') {
+                builder.append(ch);
+                continue;
+            }
+
+            switch (m_lexer.consume()) {
+            case '"':
+                builder.append('"');
+                break;
+            case '\\':
+                builder.append('\\');
+                break;
+            case '/':
+                builder.append('/');
+                break;
+            case 'b':
+                builder.append('\b');
+                break;
+            case 'f':
+                builder.append('\f');
+                break;
+            case 'n':
+                builder.append('\n');
+                break;
+            case 'r':
+                builder.append('\r');
+                break;
+            case 't':
+                builder.append('\t');
+                break;
+            case 'u': {
+                auto code_unit = parse_hex_escape();
+                if (!code_unit.has_value())
+                    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+                u32 code_point = *code_unit;
+                if (Utf16View::is_high_surrogate(*code_unit) && m_lexer.next_is("\\u"sv)) {
+                    auto saved_position = m_lexer.tell();
+                    m_lexer.ignore(2);
+                    if (auto low_surrogate = parse_hex_escape(); low_surrogate.has_value() && Utf16View::is_low_surrogate(*low_surrogate))
+                        code_point = Utf16View::decode_surrogate_pair(*code_unit, *low_surrogate);
+                    else
+                        m_lexer.retreat(m_lexer.tell() - saved_position);
+                }
+                builder.append_code_point(code_point);
+                break;
+            }
+            default:
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            }
+        }
+
+        return builder.to_deprecated_string();
+    }
+
+    Optional<u16> parse_hex_escape()
+    {
+        if (m_lexer.tell_remaining() < 4)
+            return {};
+        return AK::StringUtils::convert_to_uint_from_hex<u16>(m_lexer.consume(4), TrimWhitespace::No);
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringView m_input;
+    GenericLexer m_lexer;
+    HashMap<Vector<FlyString>, Shape*, JSONKeySequenceTraits> m_shape_cache;
+};
+
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
 JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 {
@@ -396,10 +704,8 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     auto string = TRY(vm.argument(0).to_string(vm));
     auto reviver = vm.argument(1);
 
-    auto json = JsonValue::from_string(string);
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-    Value unfiltered = parse_json_value(vm, json.value());
+    JSONParser parser(vm, string);
+    Value unfiltered = TRY(parser.parse());
     if (reviver.is_function()) {
         auto root = Object::create(realm, realm.intrinsics().object_prototype());
         auto root_name = DeprecatedString::empty();
@@ -45,6 +45,7 @@ class Object : public Cell {
 
 public:
     static NonnullGCPtr<Object> create(Realm&, Object* prototype);
+    static NonnullGCPtr<Object> create_with_premade_shape(Shape&);
 
     virtual void initialize(Realm&) override;
     virtual ~Object();
@@ -159,6 +160,7 @@ public:
     void define_native_accessor(Realm&, PropertyKey const&, SafeFunction<ThrowCompletionOr<Value>(VM&)> getter, SafeFunction<ThrowCompletionOr<Value>(VM&)> setter, PropertyAttributes attributes);
 
     virtual bool is_function() const { return false; }
+    virtual bool is_array_exotic_object() const { return false; }
     virtual bool is_typed_array() const { return false; }
     virtual bool is_string_object() const { return false; }
     virtual bool is_global_object() const { return false; }
@@ -169,12 +171,16 @@ public:
     // B.3.7 The [[IsHTMLDDA]] Internal Slot, https://tc39.es/ecma262/#sec-IsHTMLDDA-internal-slot
     virtual bool is_htmldda() const { return false; }
 
+    // NOTE: This lets LibWeb's generated bindings recognize DOM nodes without a dynamic_cast.
+    virtual bool is_dom_node() const { return false; }
+
     bool has_parameter_map() const { return m_has_parameter_map; }
     void set_has_parameter_map() { m_has_parameter_map = true; }
 
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
+    void put_direct(size_t index, Value value) { m_storage[index] = value; }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
@@ -213,8 +219,12 @@ private:
     Object* prototype() { return shape().prototype(); }
     Object const* prototype() const { return shape().prototype(); }
 
+    // The first few named property values are stored inline, so small objects don't need a separate
+    // allocation for them. With 3 slots, plain objects and arrays both still fit in the 96 byte cell size class.
+    static constexpr size_t inline_property_slot_count = 3;
+
     Shape* m_shape { nullptr };
-    Vector<Value> m_storage;
+    Vector<Value, inline_property_slot_count> m_storage;
     IndexedProperties m_indexed_properties;
     OwnPtr<Vector<PrivateElement>> m_private_elements; // [[PrivateElements]]
 };
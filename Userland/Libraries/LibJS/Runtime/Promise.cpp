@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/PromiseResolvingFunction.h>
@@ -32,6 +33,16 @@ ThrowCompletionOr<Object*> promise_resolve(VM& vm, Object& constructor, Value va
             return &static_cast<Promise&>(value.as_object());
     }
 
+    // NOTE: Resolving a promise of the intrinsic %Promise% with a non-object can't be observed, so we can fulfill a new
+    //       promise directly instead of going through NewPromiseCapability and the resolving functions it creates.
+    //       This is the common case of awaiting a value that isn't a promise.
+    auto& realm = *vm.current_realm();
+    if (!value.is_object() && &constructor == realm.intrinsics().promise_constructor()) {
+        auto promise = Promise::create(realm);
+        promise->fulfill(value);
+        return promise.ptr();
+    }
+
     // 2. Let promiseCapability be ? NewPromiseCapability(C).
     auto promise_capability = TRY(new_promise_capability(vm, &constructor));
 
@@ -6,8 +6,11 @@
 
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseConstructor.h>
 
 namespace JS {
 
@@ -41,6 +44,14 @@ ThrowCompletionOr<NonnullGCPtr<PromiseCapability>> new_promise_capability(VM& vm
 
     // 2. NOTE: C is assumed to be a constructor function that supports the parameter conventions of the Promise constructor (see 27.2.3.1).
 
+    // NOTE: Constructing the intrinsic %Promise% can't be observed, so we can skip creating the executor function and
+    //       directly use the promise's resolving functions.
+    if (&constructor.as_object() == realm.intrinsics().promise_constructor()) {
+        auto promise = Promise::create(realm);
+        auto [resolve_function, reject_function] = promise->create_resolving_functions();
+        return PromiseCapability::create(vm, promise, &resolve_function, &reject_function);
+    }
+
     // 3. Let promiseCapability be the PromiseCapability Record { [[Promise]]: undefined, [[Resolve]]: undefined, [[Reject]]: undefined }.
     auto promise_capability = PromiseCapability::create(vm, nullptr, nullptr, nullptr);
 
@@ -92,9 +92,7 @@ PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value
 {
     // 1. Let job be a new Job Abstract Closure with no parameters that captures reaction and argument and performs the following steps when called:
     //    See run_reaction_job for "the following steps".
-    auto job = [&vm, reaction = make_handle(&reaction), argument = make_handle(argument)] {
-        return run_reaction_job(vm, *reaction.cell(), argument.value());
-    };
+    auto job = PromiseJobClosure::create_reaction_job(reaction, argument);
 
     // 2. Let handlerRealm be null.
     Realm* handler_realm { nullptr };
@@ -166,12 +164,31 @@ PromiseJob create_promise_resolve_thenable_job(VM& vm, Promise& promise_to_resol
 
     // 1. Let job be a new Job Abstract Closure with no parameters that captures promiseToResolve, thenable, and then and performs the following steps when called:
     //    See run_resolve_thenable_job() for "the following steps".
-    auto job = [&vm, promise_to_resolve = make_handle(promise_to_resolve), thenable = make_handle(thenable), then = move(then)]() mutable {
-        return run_resolve_thenable_job(vm, *promise_to_resolve.cell(), thenable.value(), then);
-    };
+    auto job = PromiseJobClosure::create_resolve_thenable_job(promise_to_resolve, thenable, move(then));
 
     // 6. Return the Record { [[Job]]: job, [[Realm]]: thenRealm }.
     return { move(job), then_realm };
 }
 
+ThrowCompletionOr<Value> PromiseJobClosure::operator()(VM& vm)
+{
+    switch (m_type) {
+    case Type::Reaction:
+        return run_reaction_job(vm, *m_reaction, m_argument);
+    case Type::ResolveThenable:
+        return run_resolve_thenable_job(vm, *m_promise_to_resolve, m_argument, *m_then);
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void PromiseJobClosure::gather_roots(HashTable<Cell*>& roots)
+{
+    if (m_reaction)
+        roots.set(m_reaction.ptr());
+    if (m_promise_to_resolve)
+        roots.set(m_promise_to_resolve.ptr());
+    if (m_argument.is_cell())
+        roots.set(&m_argument.as_cell());
+}
+
 }
@@ -14,8 +14,55 @@
 
 namespace JS {
 
+// The Job Abstract Closure of a PromiseJob.
+// NOTE: Rather than allocating a closure (and handles for everything it captures) for every job, we store the captured
+//       values inline. Queued jobs must therefore either be visited by the GC (see VM::gather_roots()) or live somewhere
+//       that is scanned conservatively, like a JS::SafeFunction.
+class PromiseJobClosure {
+public:
+    enum class Type {
+        Reaction,
+        ResolveThenable,
+    };
+
+    static PromiseJobClosure create_reaction_job(PromiseReaction& reaction, Value argument)
+    {
+        return PromiseJobClosure { Type::Reaction, &reaction, nullptr, argument, {} };
+    }
+
+    static PromiseJobClosure create_resolve_thenable_job(Promise& promise_to_resolve, Value thenable, JobCallback then)
+    {
+        return PromiseJobClosure { Type::ResolveThenable, nullptr, &promise_to_resolve, thenable, move(then) };
+    }
+
+    ThrowCompletionOr<Value> operator()(VM&);
+
+    Type type() const { return m_type; }
+
+    void gather_roots(HashTable<Cell*>&);
+
+private:
+    PromiseJobClosure(Type type, GCPtr<PromiseReaction> reaction, GCPtr<Promise> promise_to_resolve, Value argument, Optional<JobCallback> then)
+        : m_type(type)
+        , m_reaction(reaction)
+        , m_promise_to_resolve(promise_to_resolve)
+        , m_argument(argument)
+        , m_then(move(then))
+    {
+    }
+
+    Type m_type;
+
+    // Captured by NewPromiseReactionJob: reaction and argument.
+    // Captured by NewPromiseResolveThenableJob: promiseToResolve, thenable (as m_argument) and then.
+    GCPtr<PromiseReaction> m_reaction;
+    GCPtr<Promise> m_promise_to_resolve;
+    Value m_argument;
+    Optional<JobCallback> m_then;
+};
+
 struct PromiseJob {
-    Function<ThrowCompletionOr<Value>()> job;
+    PromiseJobClosure job;
     Realm* realm { nullptr };
 };
 
@@ -128,6 +128,32 @@ ThrowCompletionOr<DeprecatedString> parse_regex_pattern(VM& vm, StringView patte
     return result.release_value();
 }
 
+Optional<Regex<ECMA262>> RegExpCompileCache::get(DeprecatedString const& pattern, DeprecatedString const& flags)
+{
+    auto it = m_entries.find(Key { pattern, flags });
+    if (it == m_entries.end())
+        return {};
+
+    it->value.last_use = ++m_use_counter;
+    return it->value.regex.clone();
+}
+
+void RegExpCompileCache::set(DeprecatedString const& pattern, DeprecatedString const& flags, Regex<ECMA262> const& regex)
+{
+    VERIFY(regex.parser_result.error == regex::Error::NoError);
+
+    if (m_entries.size() >= max_entry_count) {
+        auto least_recently_used = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_use < least_recently_used->value.last_use)
+                least_recently_used = it;
+        }
+        m_entries.remove(least_recently_used);
+    }
+
+    m_entries.set(Key { pattern, flags }, Entry { regex.clone(), ++m_use_counter });
+}
+
 NonnullGCPtr<RegExpObject> RegExpObject::create(Realm& realm)
 {
     return realm.heap().allocate<RegExpObject>(realm, *realm.intrinsics().regexp_prototype());
@@ -188,26 +214,35 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
         return vm.throw_completion<SyntaxError>(parsed_flags_or_error.release_error());
     auto parsed_flags = parsed_flags_or_error.release_value();
 
-    auto parsed_pattern = DeprecatedString::empty();
-    if (!pattern.is_empty()) {
-        bool unicode = parsed_flags.has_flag_set(regex::ECMAScriptFlags::Unicode);
-        bool unicode_sets = parsed_flags.has_flag_set(regex::ECMAScriptFlags::UnicodeSets);
-
-        // 11. If u is true, then
-        //     a. Let patternText be StringToCodePoints(P).
-        // 12. Else,
-        //     a. Let patternText be the result of interpreting each of P's 16-bit elements as a Unicode BMP code point. UTF-16 decoding is not applied to the elements.
-        // 13. Let parseResult be ParsePattern(patternText, u, v).
-        parsed_pattern = TRY(parse_regex_pattern(vm, pattern, unicode, unicode_sets));
-    }
+    // NOTE: Only successfully compiled patterns are cached, so a cache hit can skip steps 11 through 14.
+    auto& compile_cache = vm.regexp_compile_cache();
+    auto regex = compile_cache.get(pattern, flags);
+
+    if (!regex.has_value()) {
+        auto parsed_pattern = DeprecatedString::empty();
+        if (!pattern.is_empty()) {
+            bool unicode = parsed_flags.has_flag_set(regex::ECMAScriptFlags::Unicode);
+            bool unicode_sets = parsed_flags.has_flag_set(regex::ECMAScriptFlags::UnicodeSets);
+
+            // 11. If u is true, then
+            //     a. Let patternText be StringToCodePoints(P).
+            // 12. Else,
+            //     a. Let patternText be the result of interpreting each of P's 16-bit elements as a Unicode BMP code point. UTF-16 decoding is not applied to the elements.
+            // 13. Let parseResult be ParsePattern(patternText, u, v).
+            parsed_pattern = TRY(parse_regex_pattern(vm, pattern, unicode, unicode_sets));
+        }
+
+        // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
+        Regex<ECMA262> compiled_regex(move(parsed_pattern), parsed_flags);
+        if (compiled_regex.parser_result.error != regex::Error::NoError)
+            return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, compiled_regex.error_string());
 
-    // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
-    Regex<ECMA262> regex(move(parsed_pattern), parsed_flags);
-    if (regex.parser_result.error != regex::Error::NoError)
-        return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, regex.error_string());
+        compile_cache.set(pattern, flags, compiled_regex);
+        regex = move(compiled_regex);
+    }
 
     // 15. Assert: parseResult is a Pattern Parse Node.
-    VERIFY(regex.parser_result.error == regex::Error::NoError);
+    VERIFY(regex->parser_result.error == regex::Error::NoError);
 
     // 16. Set obj.[[OriginalSource]] to P.
     m_pattern = move(pattern);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <AK/Result.h>
 #include <LibJS/Runtime/Object.h>
@@ -23,6 +24,37 @@ struct ParseRegexPatternError {
 ErrorOr<DeprecatedString, ParseRegexPatternError> parse_regex_pattern(StringView pattern, bool unicode, bool unicode_sets);
 ThrowCompletionOr<DeprecatedString> parse_regex_pattern(VM& vm, StringView pattern, bool unicode, bool unicode_sets);
 
+// NON-STANDARD: Compiling a pattern means parsing and optimizing it, so we keep the most recently used compiled patterns
+// around per VM. RegExp objects created with the same source text and flags get a copy of the cached bytecode, and
+// only their match state is their own.
+class RegExpCompileCache {
+public:
+    static constexpr size_t max_entry_count = 64;
+
+    Optional<Regex<ECMA262>> get(DeprecatedString const& pattern, DeprecatedString const& flags);
+    void set(DeprecatedString const& pattern, DeprecatedString const& flags, Regex<ECMA262> const&);
+
+private:
+    struct Key {
+        DeprecatedString pattern;
+        DeprecatedString flags;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct KeyTraits : public GenericTraits<Key> {
+        static unsigned hash(Key const& key) { return pair_int_hash(key.pattern.hash(), key.flags.hash()); }
+    };
+
+    struct Entry {
+        Regex<ECMA262> regex;
+        u64 last_use { 0 };
+    };
+
+    HashMap<Key, Entry, KeyTraits> m_entries;
+    u64 m_use_counter { 0 };
+};
+
 class RegExpObject : public Object {
     JS_OBJECT(RegExpObject, Object);
 
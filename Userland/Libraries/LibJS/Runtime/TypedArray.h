@@ -60,6 +60,12 @@ public:
     // 25.1.2.13 GetModifySetValueInBuffer ( arrayBuffer, byteIndex, type, value, op [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-getmodifysetvalueinbuffer
     virtual Value get_modify_set_value_in_buffer(size_t byte_index, Value value, ReadWriteModifyFunction operation, bool is_little_endian = true) = 0;
 
+    // NON-STANDARD: Direct element access for fast paths that have already done the checks IntegerIndexedElementGet and
+    //               IntegerIndexedElementSet would do, i.e. the buffer is not detached and index < [[ArrayLength]].
+    //               The value passed to set_element() must already be a Number or BigInt, matching [[ContentType]].
+    virtual Value get_element(u32 index) const = 0;
+    virtual void set_element(u32 index, Value) = 0;
+
 protected:
     TypedArrayBase(Object& prototype, IntrinsicConstructor intrinsic_constructor)
         : Object(ConstructWithPrototypeTag::Tag, prototype)
@@ -441,6 +447,9 @@ public:
     void set_value_in_buffer(size_t byte_index, Value value, ArrayBuffer::Order order, bool is_little_endian = true) override { viewed_array_buffer()->template set_value<T>(byte_index, value, true, order, is_little_endian); }
     Value get_modify_set_value_in_buffer(size_t byte_index, Value value, ReadWriteModifyFunction operation, bool is_little_endian = true) override { return viewed_array_buffer()->template get_modify_set_value<T>(byte_index, value, move(operation), is_little_endian); }
 
+    Value get_element(u32 index) const override { return raw_value_to_numeric<T>(vm(), data()[index]); }
+    void set_element(u32 index, Value value) override { data()[index] = numeric_to_raw_value<T>(vm(), value); }
+
 protected:
     TypedArray(Object& prototype, IntrinsicConstructor intrinsic_constructor, u32 array_length, ArrayBuffer& array_buffer)
         : TypedArrayBase(prototype, intrinsic_constructor)
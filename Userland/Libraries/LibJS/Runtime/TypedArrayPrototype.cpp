@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -164,6 +165,134 @@ static ThrowCompletionOr<TypedArrayBase*> typed_array_species_create(VM& vm, Typ
     return result;
 }
 
+template<typename T>
+static Optional<u32> find_raw_value(Span<T const> elements, double search_element, i64 start, bool backwards, bool nan_matches)
+{
+    auto find = [&](auto matches) -> Optional<u32> {
+        if (backwards) {
+            for (auto k = start; k >= 0; --k) {
+                if (matches(elements[k]))
+                    return static_cast<u32>(k);
+            }
+        } else {
+            for (auto k = start; k < static_cast<i64>(elements.size()); ++k) {
+                if (matches(elements[k]))
+                    return static_cast<u32>(k);
+            }
+        }
+        return {};
+    };
+
+    if constexpr (IsFloatingPoint<T>) {
+        if (isnan(search_element)) {
+            if (!nan_matches)
+                return {};
+            return find([](T element) { return isnan(element); });
+        }
+    } else {
+        // NOTE: An integer element can only be equal to a search element that is an integer within the element type's range.
+        if (isnan(search_element) || search_element < NumericLimits<T>::min() || search_element > NumericLimits<T>::max() || trunc(search_element) != search_element)
+            return {};
+    }
+
+    // NOTE: The search element has to survive the round trip through the element type, otherwise no element can be equal to it.
+    auto raw_search_element = static_cast<T>(search_element);
+    if (static_cast<double>(raw_search_element) != search_element)
+        return {};
+
+    // NOTE: Like IsStrictlyEqual and SameValueZero, == considers +0 and -0 to be equal.
+    return find([raw_search_element](T element) { return element == raw_search_element; });
+}
+
+// OPTIMIZATION: includes, indexOf, and lastIndexOf compare Number elements with a Number search element in the end, so we can scan the
+//               underlying buffer directly instead of creating a Value for each element. Returns an empty Optional if the fast path
+//               doesn't apply (BigInt elements or a detached buffer), otherwise the index of the match, or -1 if there is none.
+static Optional<i64> search_number_typed_array(TypedArrayBase const& typed_array, Value search_element, i64 start, bool backwards, bool nan_matches)
+{
+    if (typed_array.content_type() != TypedArrayBase::ContentType::Number || typed_array.viewed_array_buffer()->is_detached())
+        return {};
+    if (!search_element.is_number())
+        return -1;
+
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)                                                          \
+    if (is<ClassName>(typed_array)) {                                                                                                       \
+        auto index = find_raw_value(static_cast<ClassName const&>(typed_array).data(), search_element.as_double(), start, backwards, nan_matches); \
+        return index.has_value() ? static_cast<i64>(*index) : -1;                                                                            \
+    }
+    JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+
+    VERIFY_NOT_REACHED();
+}
+
+template<typename T>
+static void radix_sort(Span<T> elements)
+{
+    using UnsignedT = MakeUnsigned<T>;
+    // NOTE: Flipping the sign bit makes the unsigned representation of signed integers sort in numeric order.
+    constexpr UnsignedT sign_bit = IsSigned<T> ? static_cast<UnsignedT>(UnsignedT(1) << (sizeof(T) * 8 - 1)) : 0;
+
+    Vector<T> scratch;
+    scratch.resize(elements.size());
+
+    Span<T> source = elements;
+    Span<T> destination = scratch.span();
+    for (size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        auto digit = [&](T value) { return ((static_cast<UnsignedT>(value) ^ sign_bit) >> shift) & 0xff; };
+
+        AK::Array<size_t, 257> offsets {};
+        for (auto value : source)
+            ++offsets[digit(value) + 1];
+        for (size_t i = 1; i < offsets.size(); ++i)
+            offsets[i] += offsets[i - 1];
+        for (auto value : source)
+            destination[offsets[digit(value)]++] = value;
+
+        swap(source, destination);
+    }
+
+    if (source.data() != elements.data())
+        source.copy_to(elements);
+}
+
+template<typename T>
+static void sort_raw_values(Span<T> elements)
+{
+    if constexpr (IsFloatingPoint<T>) {
+        // NOTE: This matches CompareTypedArrayElements: NaN sorts after everything else, and -0 sorts before +0.
+        quick_sort(elements, [](T x, T y) {
+            if (isnan(x))
+                return false;
+            if (isnan(y))
+                return true;
+            if (x != y)
+                return x < y;
+            return signbit(x) && !signbit(y);
+        });
+    } else if (elements.size() < 64) {
+        quick_sort(elements);
+    } else {
+        radix_sort(elements);
+    }
+}
+
+// OPTIMIZATION: Without a comparefn, the sorted order only depends on the element values, which SortIndexedProperties can only
+//               observe by reading them from the buffer. So we sort the underlying buffer in place instead.
+static void sort_typed_array_without_comparefn(TypedArrayBase& typed_array)
+{
+    VERIFY(!typed_array.viewed_array_buffer()->is_detached());
+
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    if (is<ClassName>(typed_array)) {                                               \
+        sort_raw_values(static_cast<ClassName&>(typed_array).data());               \
+        return;                                                                     \
+    }
+    JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+
+    VERIFY_NOT_REACHED();
+}
+
 // 23.2.3.1 %TypedArray%.prototype.at ( index ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::at)
 {
@@ -335,48 +464,23 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::copy_within)
             return typed_array;
         }
 
-        i8 direction;
+        auto& buffer_data = buffer->buffer();
+        VERIFY(from_plus_count.value() <= buffer_data.size());
 
         // i. If fromByteIndex < toByteIndex and toByteIndex < fromByteIndex + countBytes, then
-        if (from_byte_index < to_byte_index && to_byte_index < from_plus_count.value()) {
-            // i. Let direction be -1.
-            direction = -1;
-
-            // ii. Set fromByteIndex to fromByteIndex + countBytes - 1.
-            from_byte_index = from_plus_count.value() - 1;
-
-            Checked<size_t> to_plus_count = to_byte_index;
-            to_plus_count += count_bytes;
-            if (to_plus_count.has_overflow()) {
-                dbgln("TypedArrayPrototype::copy_within: to_plus_count overflowed, returning as if succeeded.");
-                return typed_array;
-            }
-
-            // iii. Set toByteIndex to toByteIndex + countBytes - 1.
-            to_byte_index = to_plus_count.value() - 1;
-        }
+        //     i. Let direction be -1.
+        //     ii. Set fromByteIndex to fromByteIndex + countBytes - 1.
+        //     iii. Set toByteIndex to toByteIndex + countBytes - 1.
         // j. Else,
-        else {
-            // i. Let direction be 1.
-            direction = 1;
-        }
-
+        //     i. Let direction be 1.
         // k. Repeat, while countBytes > 0,
-        for (; count_bytes > 0; --count_bytes) {
-            // i. Let value be GetValueFromBuffer(buffer, fromByteIndex, Uint8, true, Unordered).
-            auto value = buffer->get_value<u8>(from_byte_index, true, ArrayBuffer::Order::Unordered);
-
-            // ii. Perform SetValueInBuffer(buffer, toByteIndex, Uint8, value, true, Unordered).
-            buffer->set_value<u8>(to_byte_index, value, true, ArrayBuffer::Order::Unordered);
-
-            // iii. Set fromByteIndex to fromByteIndex + direction.
-            from_byte_index += direction;
-
-            // iv. Set toByteIndex to toByteIndex + direction.
-            to_byte_index += direction;
-
-            // v. Set countBytes to countBytes - 1.
-        }
+        //     i. Let value be GetValueFromBuffer(buffer, fromByteIndex, Uint8, true, Unordered).
+        //     ii. Perform SetValueInBuffer(buffer, toByteIndex, Uint8, value, true, Unordered).
+        //     iii. Set fromByteIndex to fromByteIndex + direction.
+        //     iv. Set toByteIndex to toByteIndex + direction.
+        //     v. Set countBytes to countBytes - 1.
+        // NOTE: Picking the copy direction based on the overlap is exactly what memmove() does, so we copy all bytes at once.
+        buffer_data.overwrite(to_byte_index, buffer_data.data() + from_byte_index, count_bytes);
     }
 
     // 18. Return O.
@@ -465,12 +569,17 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
         return vm.throw_completion<TypeError>(ErrorType::DetachedArrayBuffer);
 
     // 15. Repeat, while k < final,
-    for (; k < final; ++k) {
-        // a. Let Pk be ! ToString(𝔽(k)).
-        // b. Perform ! Set(O, Pk, value, true).
-        MUST(typed_array->set(k, value, Object::ShouldThrowExceptions::Yes));
+    //     a. Let Pk be ! ToString(𝔽(k)).
+    //     b. Perform ! Set(O, Pk, value, true).
+    //     c. Set k to k + 1.
+    // NOTE: Every element gets the same bit pattern, so we convert the value once and then keep doubling the filled range.
+    if (k < final) {
+        typed_array->set_element(k, value);
 
-        // c. Set k to k + 1.
+        auto element_size = typed_array->element_size();
+        auto bytes = typed_array->viewed_array_buffer()->buffer().bytes().slice(typed_array->byte_offset() + k * element_size, (final - k) * element_size);
+        for (size_t filled = element_size; filled < bytes.size(); filled *= 2)
+            bytes.slice(0, min(filled, bytes.size() - filled)).copy_to(bytes.slice(filled));
     }
 
     // 16. Return O.
@@ -653,6 +762,10 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
     }
 
     auto search_element = vm.argument(0);
+
+    if (auto index = search_number_typed_array(*typed_array, search_element, k, false, true); index.has_value())
+        return Value(*index != -1);
+
     // 11. Repeat, while k < len,
     for (; k < length; ++k) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -715,8 +828,12 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
-    // 11. Repeat, while k < len,
     auto search_element = vm.argument(0);
+
+    if (auto index = search_number_typed_array(*typed_array, search_element, k, false, false); index.has_value())
+        return Value(static_cast<double>(*index));
+
+    // 11. Repeat, while k < len,
     for (; k < length; ++k) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
         auto k_present = MUST(typed_array->has_property(k));
@@ -826,6 +943,10 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
     }
 
     auto search_element = vm.argument(0);
+
+    if (auto index = search_number_typed_array(*typed_array, search_element, k, true, false); index.has_value())
+        return Value(static_cast<double>(*index));
+
     for (; k >= 0; --k) {
         auto k_present = MUST(typed_array->has_property(k));
         if (k_present) {
@@ -1196,6 +1317,15 @@ static ThrowCompletionOr<void> set_typed_array_from_array_like(VM& vm, TypedArra
         // b. Let value be ? Get(src, Pk).
         auto value = TRY(src->get(k));
 
+        // OPTIMIZATION: A value that already has the target's content type needs no conversion, and can be written directly.
+        auto target_index_value = static_cast<u32>(target_offset) + k;
+        if (!target.viewed_array_buffer()->is_detached() && target_index_value < target.array_length()
+            && (target.content_type() == TypedArrayBase::ContentType::BigInt ? value.is_bigint() : value.is_number())) {
+            target.set_element(target_index_value, value);
+            ++k;
+            continue;
+        }
+
         // c. Let targetIndex be 𝔽(targetOffset + k).
         // NOTE: We verify above that target_offset + source_length is valid, so this cannot fail.
         auto target_index = MUST(CanonicalIndex::from_double(vm, CanonicalIndex::Type::Index, target_offset + k));
@@ -1370,6 +1500,15 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::slice)
             }
 
             // ix. Repeat, while targetByteIndex < limit,
+            // NOTE: Unless a species constructor handed us a view on the source buffer, the ranges can't overlap, and a byte-wise
+            //       copy is equivalent to a single memcpy().
+            if (&source_buffer != &target_buffer) {
+                auto count_bytes = limit.value() - target_byte_index;
+                VERIFY(source_byte_index.value() + count_bytes <= source_buffer.byte_length());
+                target_buffer.buffer().overwrite(target_byte_index, source_buffer.buffer().data() + source_byte_index.value(), count_bytes);
+                return new_array;
+            }
+
             for (; target_byte_index < limit.value(); ++source_byte_index, ++target_byte_index) {
                 // 1. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, Uint8, true, Unordered).
                 auto value = source_buffer.get_value<u8>(source_byte_index.value(), true, ArrayBuffer::Unordered);
@@ -1417,6 +1556,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be obj.[[ArrayLength]].
     auto length = typed_array->array_length();
 
+    if (compare_fn.is_undefined()) {
+        sort_typed_array_without_comparefn(*typed_array);
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -1628,6 +1772,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* return_array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // NOTE: A has the same element type as O, so without a comparefn we can copy O's elements and sort them in place.
+    if (comparefn.is_undefined()) {
+        return_array->viewed_array_buffer()->buffer().overwrite(return_array->byte_offset(), typed_array->viewed_array_buffer()->buffer().data() + typed_array->byte_offset(), length * typed_array->element_size());
+        sort_typed_array_without_comparefn(*return_array);
+        return return_array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in  Array.prototype.toSorted
     // 7. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
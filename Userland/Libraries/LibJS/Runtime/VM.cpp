@@ -12,6 +12,8 @@
 #include <AK/StringBuilder.h>
 #include <LibCore/File.h>
 #include <LibJS/AST.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Interpreter.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -24,7 +26,9 @@
 #include <LibJS/Runtime/IteratorOperations.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/RegExpObject.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/SourceTextModule.h>
@@ -38,7 +42,8 @@ NonnullRefPtr<VM> VM::create(OwnPtr<CustomData> custom_data)
 }
 
 VM::VM(OwnPtr<CustomData> custom_data)
-    : m_heap(*this)
+    : m_regexp_compile_cache(make<RegExpCompileCache>())
+    , m_heap(*this)
     , m_custom_data(move(custom_data))
 {
     m_empty_string = m_heap.allocate_without_realm<PrimitiveString>(DeprecatedString::empty());
@@ -59,7 +64,7 @@ VM::VM(OwnPtr<CustomData> custom_data)
         enqueue_finalization_registry_cleanup_job(finalization_registry);
     };
 
-    host_enqueue_promise_job = [this](Function<ThrowCompletionOr<Value>()> job, Realm* realm) {
+    host_enqueue_promise_job = [this](PromiseJobClosure job, Realm* realm) {
         enqueue_promise_job(move(job), realm);
     };
 
@@ -145,6 +150,20 @@ VM::VM(OwnPtr<CustomData> custom_data)
 #undef __JS_ENUMERATE
 }
 
+VM::~VM() = default;
+
+void VM::start_sampling_profiler(Time interval)
+{
+    m_sampling_profiler = make<Bytecode::SamplingProfiler>(interval);
+}
+
+OwnPtr<Bytecode::SamplingProfiler> VM::stop_sampling_profiler()
+{
+    if (m_sampling_profiler)
+        m_sampling_profiler->stop();
+    return move(m_sampling_profiler);
+}
+
 void VM::enable_default_host_import_module_dynamically_hook()
 {
     host_import_module_dynamically = [&](ScriptOrModule referencing_script_or_module, ModuleRequest const& specifier, PromiseCapability const& promise_capability) {
@@ -219,6 +238,9 @@ void VM::gather_roots(HashTable<Cell*>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
+    if (auto* bytecode_interpreter = Bytecode::Interpreter::current(); bytecode_interpreter && &bytecode_interpreter->vm() == this)
+        bytecode_interpreter->gather_roots(roots);
+
 #define __JS_ENUMERATE(SymbolName, snake_name) \
     roots.set(well_known_symbol_##snake_name());
     JS_ENUMERATE_WELL_KNOWN_SYMBOLS
@@ -227,6 +249,9 @@ void VM::gather_roots(HashTable<Cell*>& roots)
     for (auto& symbol : m_global_symbol_registry)
         roots.set(symbol.value);
 
+    for (size_t i = m_first_queued_promise_job; i < m_promise_jobs.size(); ++i)
+        m_promise_jobs[i].gather_roots(roots);
+
     for (auto* finalization_registry : m_finalization_registry_cleanup_jobs)
         roots.set(finalization_registry);
 }
@@ -641,16 +666,19 @@ void VM::run_queued_promise_jobs()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
+    while (m_first_queued_promise_job < m_promise_jobs.size()) {
+        auto job = move(m_promise_jobs[m_first_queued_promise_job++]);
         dbgln_if(PROMISE_DEBUG, "Calling promise job function");
 
-        [[maybe_unused]] auto result = job();
+        [[maybe_unused]] auto result = job(*this);
     }
+
+    m_promise_jobs.clear_with_capacity();
+    m_first_queued_promise_job = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
-void VM::enqueue_promise_job(Function<ThrowCompletionOr<Value>()> job, Realm*)
+void VM::enqueue_promise_job(PromiseJobClosure job, Realm*)
 {
     // An implementation of HostEnqueuePromiseJob must conform to the requirements in 9.5 as well as the following:
     // - FIXME: If realm is not null, each time job is invoked the implementation must perform implementation-defined steps such that execution is prepared to evaluate ECMAScript code at the time of job's invocation.
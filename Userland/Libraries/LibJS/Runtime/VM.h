@@ -39,7 +39,7 @@ public:
     };
 
     static NonnullRefPtr<VM> create(OwnPtr<CustomData> = {});
-    ~VM() = default;
+    ~VM();
 
     Heap& heap() { return m_heap; }
     Heap const& heap() const { return m_heap; }
@@ -77,6 +77,12 @@ public:
     {
         return m_string_cache;
     }
+    RegExpCompileCache& regexp_compile_cache() { return *m_regexp_compile_cache; }
+
+    Bytecode::SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+    void start_sampling_profiler(Time interval);
+    OwnPtr<Bytecode::SamplingProfiler> stop_sampling_profiler();
+
     PrimitiveString& empty_string() { return *m_empty_string; }
     PrimitiveString& single_ascii_character_string(u8 character)
     {
@@ -199,7 +205,7 @@ public:
     CommonPropertyNames names;
 
     void run_queued_promise_jobs();
-    void enqueue_promise_job(Function<ThrowCompletionOr<Value>()> job, Realm*);
+    void enqueue_promise_job(PromiseJobClosure job, Realm*);
 
     void run_queued_finalization_registry_cleanup_jobs();
     void enqueue_finalization_registry_cleanup_job(FinalizationRegistry&);
@@ -240,7 +246,7 @@ public:
     Function<void(Promise&, Promise::RejectionOperation)> host_promise_rejection_tracker;
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, MarkedVector<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
-    Function<void(Function<ThrowCompletionOr<Value>()>, Realm*)> host_enqueue_promise_job;
+    Function<void(PromiseJobClosure, Realm*)> host_enqueue_promise_job;
     Function<JobCallback(FunctionObject&)> host_make_job_callback;
     Function<ThrowCompletionOr<void>(Realm&)> host_ensure_can_compile_strings;
     Function<ThrowCompletionOr<void>(Object&)> host_ensure_can_add_private_element;
@@ -258,6 +264,8 @@ private:
     void finish_dynamic_import(ScriptOrModule referencing_script_or_module, ModuleRequest module_request, PromiseCapability const& promise_capability, Promise* inner_promise);
 
     HashMap<DeprecatedString, PrimitiveString*> m_string_cache;
+    NonnullOwnPtr<RegExpCompileCache> m_regexp_compile_cache;
+    OwnPtr<Bytecode::SamplingProfiler> m_sampling_profiler;
 
     Heap m_heap;
     Vector<Interpreter*> m_interpreters;
@@ -271,7 +279,9 @@ private:
     // GlobalSymbolRegistry, https://tc39.es/ecma262/#table-globalsymbolregistry-record-fields
     HashMap<DeprecatedString, NonnullGCPtr<Symbol>> m_global_symbol_registry;
 
-    Vector<Function<ThrowCompletionOr<Value>()>> m_promise_jobs;
+    // NOTE: Jobs are taken from the front of the queue, which only gets cleared (keeping its capacity) once it has been drained.
+    Vector<PromiseJobClosure> m_promise_jobs;
+    size_t m_first_queued_promise_job { 0 };
 
     Vector<FinalizationRegistry*> m_finalization_registry_cleanup_jobs;
 
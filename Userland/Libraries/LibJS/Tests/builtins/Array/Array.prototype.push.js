@@ -21,3 +21,30 @@ describe("normal behavior", () => {
         expect(a).toEqual(["hello", "friends", 1, 2, 3]);
     });
 });
+
+describe("observable behavior", () => {
+    test("setter on Array.prototype is called for pushed index", () => {
+        const values = [];
+        Object.defineProperty(Array.prototype, 1, {
+            configurable: true,
+            set(value) {
+                values.push(value);
+            },
+        });
+        try {
+            var a = ["hello"];
+            expect(a.push("friends")).toBe(2);
+            expect(values).toEqual(["friends"]);
+            expect(a.hasOwnProperty(1)).toBeFalse();
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("non-writable length", () => {
+        var a = ["hello"];
+        Object.defineProperty(a, "length", { writable: false });
+        expect(() => a.push("friends")).toThrow(TypeError);
+        expect(a).toHaveLength(1);
+    });
+});
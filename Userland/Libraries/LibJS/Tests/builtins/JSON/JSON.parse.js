@@ -74,3 +74,22 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("objects with the same keys", () => {
+    const records = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6},{"a":7,"a":8},{"0":9,"a":10}]');
+    expect(records[0]).toEqual({ a: 1, b: 2 });
+    expect(records[1]).toEqual({ a: 3, b: 4 });
+    expect(Object.keys(records[2])).toEqual(["b", "a"]);
+    expect(records[3]).toEqual({ a: 8 });
+    expect(Object.keys(records[4])).toEqual(["0", "a"]);
+
+    records[1].c = 11;
+    expect(records[0].c).toBeUndefined();
+});
+
+test("unicode escapes", () => {
+    expect(JSON.parse('"\\u0041\\u00e9"')).toBe("Aé");
+    expect(JSON.parse('"\\ud83d\\ude00"')).toBe("😀");
+    expect(() => JSON.parse('"\\u12"')).toThrow(SyntaxError);
+    expect(() => JSON.parse('"\\u 123"')).toThrow(SyntaxError);
+});
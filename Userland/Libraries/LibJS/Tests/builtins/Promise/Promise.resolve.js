@@ -30,6 +30,22 @@ describe("normal behavior", () => {
         runQueuedPromiseJobs();
         expect(fulfillmentValue).toBe("Some value");
     });
+
+    test("jobs run in the order they were queued", () => {
+        const order = [];
+        const thenable = {
+            then(resolve) {
+                order.push("then");
+                resolve("thenable");
+            },
+        };
+        Promise.resolve(thenable).then(value => order.push(value));
+        Promise.resolve(1).then(value => order.push(value));
+        Promise.resolve(2).then(value => order.push(value));
+        gc();
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["then", 1, 2, "thenable"]);
+    });
 });
 
 describe("errors", () => {
@@ -60,3 +60,19 @@ test("regexp literals are re-useable", () => {
         expect(re.test("test")).toBeTrue();
     }
 });
+
+test("regexps with the same pattern and flags have separate match state", () => {
+    const a = new RegExp("\\d", "g");
+    const b = new RegExp("\\d", "g");
+    expect(a.exec("1 2").index).toBe(0);
+    expect(a.exec("1 2").index).toBe(2);
+    expect(b.exec("1 2").index).toBe(0);
+    expect(/\d/y.test("a1")).toBeFalse();
+    expect(new RegExp("\\d", "y").test("1a")).toBeTrue();
+});
+
+test("invalid patterns keep throwing", () => {
+    for (var i = 0; i < 2; ++i) {
+        expect(() => new RegExp("(", "g")).toThrow(SyntaxError);
+    }
+});
@@ -99,3 +99,13 @@ describe("normal behavior", () => {
         });
     });
 });
+
+test("overlapping ranges", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const forwards = new T([1, 2, 3, 4, 5]);
+        expect(forwards.copyWithin(1, 0, 4)).toEqual([1, 1, 2, 3, 4]);
+
+        const backwards = new T([1, 2, 3, 4, 5]);
+        expect(backwards.copyWithin(0, 1)).toEqual([2, 3, 4, 5, 5]);
+    });
+});
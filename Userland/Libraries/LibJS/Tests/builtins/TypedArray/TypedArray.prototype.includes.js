@@ -42,3 +42,12 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("search element is compared after conversion to the element type", () => {
+    expect(new Float32Array([0.1]).includes(0.1)).toBe(false);
+    expect(new Float32Array([0.5]).includes(0.5)).toBe(true);
+    expect(new Float64Array([NaN]).includes(NaN)).toBe(true);
+    expect(new Uint8Array([0]).includes(-0)).toBe(true);
+    expect(new Uint8Array([255]).includes(-1)).toBe(false);
+    expect(new Uint8Array([1]).includes("1")).toBe(false);
+});
@@ -69,3 +69,20 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("numeric order without comparefn", () => {
+    const floats = new Float64Array([3, NaN, 0, -0, -Infinity, 1, Infinity, -1]).sort();
+    expect(floats).toEqual([-Infinity, -1, -0, 0, 1, 3, Infinity, NaN]);
+    expect(Object.is(floats[2], -0)).toBeTrue();
+    expect(Object.is(floats[3], 0)).toBeTrue();
+
+    const integers = new Int32Array(1000);
+    for (let i = 0; i < integers.length; ++i) integers[i] = ((i * 7919) % 2001) - 1000;
+    const expected = Array.from(integers).sort((a, b) => a - b);
+    expect(integers.sort()).toEqual(expected);
+
+    const bigints = new BigInt64Array(100);
+    for (let i = 0; i < bigints.length; ++i) bigints[i] = BigInt(((i * 37) % 101) - 50);
+    const expectedBigInts = Array.from(bigints).sort((a, b) => (a < b ? -1 : a > b ? 1 : 0));
+    expect(bigints.sort()).toEqual(expectedBigInts);
+});
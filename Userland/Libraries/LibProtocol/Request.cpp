@@ -114,6 +114,34 @@ void Request::set_should_buffer_all_input(bool value)
     stream_into(m_internal_buffered_data->payload_stream);
 }
 
+void Request::set_unbuffered_request_callbacks(HeadersReceived on_headers_received, DataReceived on_data_received, RequestFinished on_finish)
+{
+    VERIFY(!m_internal_buffered_data);
+    VERIFY(!m_internal_stream_data);
+
+    m_should_buffer_all_input = false;
+    m_unbuffered_data_stream = make<UnbufferedDataStream>(move(on_data_received));
+    this->on_headers_received = move(on_headers_received);
+    this->on_finish = move(on_finish);
+
+    stream_into(*m_unbuffered_data_stream);
+}
+
+void Request::set_reading_paused(bool paused)
+{
+    VERIFY(m_internal_stream_data);
+
+    if (m_internal_stream_data->read_stream->is_eof())
+        return;
+    m_internal_stream_data->read_notifier->set_enabled(!paused);
+}
+
+ErrorOr<size_t> Request::UnbufferedDataStream::write(ReadonlyBytes bytes)
+{
+    m_on_data_received(bytes);
+    return bytes.size();
+}
+
 void Request::did_finish(Badge<RequestClient>, bool success, u32 total_size)
 {
     if (!on_finish)
@@ -45,6 +45,17 @@ public:
     /// Note: Will override `on_finish', and `on_headers_received', and expects `on_buffered_request_finish' to be set!
     void set_should_buffer_all_input(bool);
 
+    using HeadersReceived = Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code)>;
+    using DataReceived = Function<void(ReadonlyBytes data)>;
+    using RequestFinished = Function<void(bool success, u32 total_size)>;
+
+    /// Note: Will override `on_finish', and `on_headers_received'. The payload is handed to `on_data_received' in chunks, as it arrives.
+    void set_unbuffered_request_callbacks(HeadersReceived, DataReceived, RequestFinished);
+
+    /// Note: Only valid once the payload is being streamed. While paused, the payload stays in the pipe to RequestServer,
+    ///       which then holds on to it instead of handing it to us.
+    void set_reading_paused(bool);
+
     /// Note: Must be set before `set_should_buffer_all_input(true)`.
     Function<void(bool success, u32 total_size, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code, ReadonlyBytes payload)> on_buffered_request_finish;
     Function<void(bool success, u32 total_size)> on_finish;
@@ -92,8 +103,27 @@ private:
         bool user_finish_called { false };
     };
 
+    // Forwards everything written to it to the request's `on_data_received'.
+    class UnbufferedDataStream final : public Core::Stream::Stream {
+    public:
+        explicit UnbufferedDataStream(DataReceived on_data_received)
+            : m_on_data_received(move(on_data_received))
+        {
+        }
+
+        virtual ErrorOr<Bytes> read(Bytes) override { return Error::from_errno(EBADF); }
+        virtual ErrorOr<size_t> write(ReadonlyBytes) override;
+        virtual bool is_eof() const override { return true; }
+        virtual bool is_open() const override { return true; }
+        virtual void close() override { }
+
+    private:
+        DataReceived m_on_data_received;
+    };
+
     OwnPtr<InternalBufferedData> m_internal_buffered_data;
     OwnPtr<InternalStreamData> m_internal_stream_data;
+    OwnPtr<UnbufferedDataStream> m_unbuffered_data_stream;
 };
 
 }
@@ -65,6 +65,21 @@ Regex<Parser>::Regex(Regex&& regex)
         matcher->reset_pattern({}, this);
 }
 
+template<class Parser>
+Regex<Parser>::Regex(Regex const& regex, CloneTag)
+    : pattern_value(regex.pattern_value)
+    , parser_result(regex.parser_result)
+{
+    if (regex.matcher)
+        matcher = make<Matcher<Parser>>(this, regex.matcher->options());
+}
+
+template<class Parser>
+Regex<Parser> Regex<Parser>::clone() const
+{
+    return Regex { *this, CloneTag {} };
+}
+
 template<class Parser>
 Regex<Parser>& Regex<Parser>::operator=(Regex&& regex)
 {
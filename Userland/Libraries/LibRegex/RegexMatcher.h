@@ -96,6 +96,9 @@ public:
     Regex(Regex&&);
     Regex& operator=(Regex&&);
 
+    // Creates a copy of this Regex with its own match state, without having to parse and optimize the pattern again.
+    Regex clone() const;
+
     typename ParserTraits<Parser>::OptionsType options() const;
     void print_bytecode(FILE* f = stdout) const;
     DeprecatedString error_string(Optional<DeprecatedString> message = {}) const;
@@ -231,6 +234,9 @@ public:
     static BasicBlockList split_basic_blocks(ByteCode const&);
 
 private:
+    struct CloneTag { };
+    Regex(Regex const&, CloneTag);
+
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
 };
@@ -14,6 +14,7 @@
 #include <LibJS/Runtime/FinalizationRegistry.h>
 #include <LibJS/Runtime/ModuleRequest.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/LocationObject.h>
@@ -208,7 +209,7 @@ JS::VM& main_thread_vm()
         };
 
         // 8.1.5.4.3 HostEnqueuePromiseJob(job, realm), https://html.spec.whatwg.org/multipage/webappapis.html#hostenqueuepromisejob
-        vm->host_enqueue_promise_job = [](Function<JS::ThrowCompletionOr<JS::Value>()> job, JS::Realm* realm) {
+        vm->host_enqueue_promise_job = [](JS::PromiseJobClosure job, JS::Realm* realm) {
             // 1. If realm is not null, then let job settings be the settings object for realm. Otherwise, let job settings be null.
             HTML::EnvironmentSettingsObject* job_settings { nullptr };
             if (realm)
@@ -225,7 +226,8 @@ JS::VM& main_thread_vm()
             auto* script = active_script();
 
             // NOTE: This keeps job_settings alive by keeping realm alive, which is holding onto job_settings.
-            HTML::queue_a_microtask(script ? script->settings_object().responsible_document().ptr() : nullptr, [job_settings, job = move(job), script_or_module = move(script_or_module)] {
+            //       The job itself is kept alive by the SafeFunction's conservatively scanned closure.
+            HTML::queue_a_microtask(script ? script->settings_object().responsible_document().ptr() : nullptr, [job_settings, job = move(job), script_or_module = move(script_or_module)]() mutable {
                 // The dummy execution context has to be kept up here to keep it alive for the duration of the function.
                 Optional<JS::ExecutionContext> dummy_execution_context;
 
@@ -255,7 +257,7 @@ JS::VM& main_thread_vm()
                 }
 
                 // 3. Let result be job().
-                [[maybe_unused]] auto result = job();
+                [[maybe_unused]] auto result = job(*vm);
 
                 // 4. If job settings is not null, then clean up after running script with job settings.
                 if (job_settings) {
@@ -389,6 +391,19 @@ JS::VM& main_thread_vm()
         root_realm->set_global_object(object, object);
         add_window_exposed_interfaces(*object, *root_realm);
 
+        // NOTE: The heap is shared between all documents on the main thread, so collections are accounted to the document
+        //       whose script was running when they happened, if any.
+        vm->heap().on_garbage_collection_finished = [](Time start, Time duration) {
+            if (vm->execution_context_stack().is_empty())
+                return;
+            auto* realm = vm->current_realm();
+            if (!realm || !is<HTML::Window>(realm->global_object()))
+                return;
+            auto& window = static_cast<HTML::Window&>(realm->global_object());
+            if (window.has_associated_document())
+                window.associated_document().performance_recorder().record(PerformancePhase::GarbageCollection, start, duration);
+        };
+
         vm->push_execution_context(*custom_data.root_execution_context);
     }
     return *vm;
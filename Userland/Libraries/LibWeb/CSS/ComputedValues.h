@@ -48,6 +48,8 @@ public:
     static CSS::Appearance appearance() { return CSS::Appearance::Auto; }
     static CSS::Overflow overflow() { return CSS::Overflow::Visible; }
     static CSS::BoxSizing box_sizing() { return CSS::BoxSizing::ContentBox; }
+    static CSS::ContentVisibility content_visibility() { return CSS::ContentVisibility::Visible; }
+    static CSS::Size contain_intrinsic_height() { return CSS::Size::make_none(); }
     static CSS::PointerEvents pointer_events() { return CSS::PointerEvents::Auto; }
     static float flex_grow() { return 0.0f; }
     static float flex_shrink() { return 1.0f; }
@@ -178,6 +180,8 @@ public:
     CSS::BackdropFilter const& backdrop_filter() const { return m_noninherited.backdrop_filter; }
     Vector<ShadowData> const& box_shadow() const { return m_noninherited.box_shadow; }
     CSS::BoxSizing box_sizing() const { return m_noninherited.box_sizing; }
+    CSS::ContentVisibility content_visibility() const { return m_noninherited.content_visibility; }
+    CSS::Size const& contain_intrinsic_height() const { return m_noninherited.contain_intrinsic_height; }
     CSS::Size const& width() const { return m_noninherited.width; }
     CSS::Size const& min_width() const { return m_noninherited.min_width; }
     CSS::Size const& max_width() const { return m_noninherited.max_width; }
@@ -308,6 +312,8 @@ protected:
         Vector<CSS::Transformation> transformations {};
         CSS::TransformOrigin transform_origin {};
         CSS::BoxSizing box_sizing { InitialValues::box_sizing() };
+        CSS::ContentVisibility content_visibility { InitialValues::content_visibility() };
+        CSS::Size contain_intrinsic_height { InitialValues::contain_intrinsic_height() };
         CSS::ContentData content;
         Variant<CSS::VerticalAlign, CSS::LengthPercentage> vertical_align { InitialValues::vertical_align() };
         CSS::GridTrackSizeList grid_template_columns;
@@ -389,6 +395,8 @@ public:
     void set_transformations(Vector<CSS::Transformation> value) { m_noninherited.transformations = move(value); }
     void set_transform_origin(CSS::TransformOrigin value) { m_noninherited.transform_origin = value; }
     void set_box_sizing(CSS::BoxSizing value) { m_noninherited.box_sizing = value; }
+    void set_content_visibility(CSS::ContentVisibility value) { m_noninherited.content_visibility = value; }
+    void set_contain_intrinsic_height(CSS::Size const& value) { m_noninherited.contain_intrinsic_height = value; }
     void set_vertical_align(Variant<CSS::VerticalAlign, CSS::LengthPercentage> value) { m_noninherited.vertical_align = move(value); }
     void set_visibility(CSS::Visibility value) { m_inherited.visibility = value; }
     void set_grid_template_columns(CSS::GridTrackSizeList value) { m_noninherited.grid_template_columns = move(value); }
@@ -964,6 +964,35 @@ CSSPixels StyleComputer::root_element_font_size() const
     return root_value->to_length().to_px(viewport_rect(), computed_root_style->computed_font().pixel_metrics(), default_root_element_font_size, default_root_element_font_size);
 }
 
+// https://w3c.github.io/csswg-drafts/css-fonts/#absolute-size-mapping
+static float absolute_size_multiplier(CSS::ValueID identifier)
+{
+    switch (identifier) {
+    case CSS::ValueID::XxSmall:
+        return 0.6f;
+    case CSS::ValueID::XSmall:
+        return 0.75f;
+    case CSS::ValueID::Small:
+        return 8.0f / 9.0f;
+    case CSS::ValueID::Medium:
+        return 1.0f;
+    case CSS::ValueID::Large:
+        return 1.2f;
+    case CSS::ValueID::XLarge:
+        return 1.5f;
+    case CSS::ValueID::XxLarge:
+        return 2.0f;
+    case CSS::ValueID::XxxLarge:
+        return 3.0f;
+    case CSS::ValueID::Smaller:
+        return 0.8f;
+    case CSS::ValueID::Larger:
+        return 1.25f;
+    default:
+        return 1.0f;
+    }
+}
+
 void StyleComputer::compute_font(StyleProperties& style, DOM::Element const* element, Optional<CSS::Selector::PseudoElement> pseudo_element) const
 {
     // To compute the font, first ensure that we've defaulted the relevant CSS font properties.
@@ -1019,20 +1048,6 @@ void StyleComputer::compute_font(StyleProperties& style, DOM::Element const* ele
     float font_size_in_px = 16;
 
     if (font_size->is_identifier()) {
-        // https://w3c.github.io/csswg-drafts/css-fonts/#absolute-size-mapping
-        AK::HashMap<Web::CSS::ValueID, float> absolute_size_mapping = {
-            { CSS::ValueID::XxSmall, 0.6 },
-            { CSS::ValueID::XSmall, 0.75 },
-            { CSS::ValueID::Small, 8.0 / 9.0 },
-            { CSS::ValueID::Medium, 1.0 },
-            { CSS::ValueID::Large, 1.2 },
-            { CSS::ValueID::XLarge, 1.5 },
-            { CSS::ValueID::XxLarge, 2.0 },
-            { CSS::ValueID::XxxLarge, 3.0 },
-            { CSS::ValueID::Smaller, 0.8 },
-            { CSS::ValueID::Larger, 1.25 },
-        };
-
         auto const identifier = static_cast<IdentifierStyleValue const&>(*font_size).id();
 
         // https://w3c.github.io/csswg-drafts/css-fonts/#valdef-font-size-relative-size
@@ -1044,8 +1059,7 @@ void StyleComputer::compute_font(StyleProperties& style, DOM::Element const* ele
                 font_size_in_px = parent_element->computed_css_values()->computed_font().pixel_metrics().size;
             }
         }
-        auto const multiplier = absolute_size_mapping.get(identifier).value_or(1.0);
-        font_size_in_px *= multiplier;
+        font_size_in_px *= absolute_size_multiplier(identifier);
 
     } else {
         auto root_font_size = root_element_font_size();
@@ -1106,91 +1120,97 @@ void StyleComputer::compute_font(StyleProperties& style, DOM::Element const* ele
         }
     }
 
-    // FIXME: Implement the full font-matching algorithm: https://www.w3.org/TR/css-fonts-4/#font-matching-algorithm
-
-    // Note: This is modified by the find_font() lambda
-    FontSelector font_selector;
-    bool monospace = false;
+    // NOTE: Matching only depends on the family list, size, weight and slope, so we cache the result. The family list
+    //       is compared by identity, which works well since it's usually inherited from the parent's style.
+    auto family_value = style.property(PropertyID::FontFamily);
+    FontMatchingKey font_matching_key { family_value, font_size_in_px, weight, slope };
+    RefPtr<Gfx::Font> found_font = m_font_matching_cache.get(font_matching_key).value_or(nullptr);
+    if (!found_font) {
+        // FIXME: Implement the full font-matching algorithm: https://www.w3.org/TR/css-fonts-4/#font-matching-algorithm
 
-    auto find_font = [&](DeprecatedString const& family) -> RefPtr<Gfx::Font> {
-        float font_size_in_pt = font_size_in_px * 0.75f;
-        font_selector = { family, font_size_in_pt, weight, slope };
+        // Note: This is modified by the find_font() lambda
+        FontSelector font_selector;
+        bool monospace = false;
 
-        if (auto it = m_loaded_fonts.find(family); it != m_loaded_fonts.end()) {
-            auto& loader = *it->value;
-            if (auto found_font = loader.font_with_point_size(font_size_in_pt))
-                return found_font;
-        }
+        auto find_font = [&](DeprecatedString const& family) -> RefPtr<Gfx::Font> {
+            float font_size_in_pt = font_size_in_px * 0.75f;
+            font_selector = { family, font_size_in_pt, weight, slope };
 
-        if (auto found_font = FontCache::the().get(font_selector))
-            return found_font;
+            if (auto it = m_loaded_fonts.find(family); it != m_loaded_fonts.end()) {
+                auto& loader = *it->value;
+                if (auto found_font = loader.font_with_point_size(font_size_in_pt))
+                    return found_font;
+            }
 
-        if (auto found_font = Gfx::FontDatabase::the().get(family, font_size_in_pt, weight, slope, Gfx::Font::AllowInexactSizeMatch::Yes))
-            return found_font;
+            if (auto found_font = FontCache::the().get(font_selector))
+                return found_font;
 
-        return {};
-    };
+            if (auto found_font = Gfx::FontDatabase::the().get(family, font_size_in_pt, weight, slope, Gfx::Font::AllowInexactSizeMatch::Yes))
+                return found_font;
 
-    auto find_generic_font = [&](ValueID font_id) -> RefPtr<Gfx::Font> {
-        Platform::GenericFont generic_font {};
-        switch (font_id) {
-        case ValueID::Monospace:
-        case ValueID::UiMonospace:
-            generic_font = Platform::GenericFont::Monospace;
-            monospace = true;
-            break;
-        case ValueID::Serif:
-            generic_font = Platform::GenericFont::Serif;
-            break;
-        case ValueID::Fantasy:
-            generic_font = Platform::GenericFont::Fantasy;
-            break;
-        case ValueID::SansSerif:
-            generic_font = Platform::GenericFont::SansSerif;
-            break;
-        case ValueID::Cursive:
-            generic_font = Platform::GenericFont::Cursive;
-            break;
-        case ValueID::UiSerif:
-            generic_font = Platform::GenericFont::UiSerif;
-            break;
-        case ValueID::UiSansSerif:
-            generic_font = Platform::GenericFont::UiSansSerif;
-            break;
-        case ValueID::UiRounded:
-            generic_font = Platform::GenericFont::UiRounded;
-            break;
-        default:
             return {};
-        }
-        return find_font(Platform::FontPlugin::the().generic_font_name(generic_font));
-    };
+        };
 
-    RefPtr<Gfx::Font> found_font;
+        auto find_generic_font = [&](ValueID font_id) -> RefPtr<Gfx::Font> {
+            Platform::GenericFont generic_font {};
+            switch (font_id) {
+            case ValueID::Monospace:
+            case ValueID::UiMonospace:
+                generic_font = Platform::GenericFont::Monospace;
+                monospace = true;
+                break;
+            case ValueID::Serif:
+                generic_font = Platform::GenericFont::Serif;
+                break;
+            case ValueID::Fantasy:
+                generic_font = Platform::GenericFont::Fantasy;
+                break;
+            case ValueID::SansSerif:
+                generic_font = Platform::GenericFont::SansSerif;
+                break;
+            case ValueID::Cursive:
+                generic_font = Platform::GenericFont::Cursive;
+                break;
+            case ValueID::UiSerif:
+                generic_font = Platform::GenericFont::UiSerif;
+                break;
+            case ValueID::UiSansSerif:
+                generic_font = Platform::GenericFont::UiSansSerif;
+                break;
+            case ValueID::UiRounded:
+                generic_font = Platform::GenericFont::UiRounded;
+                break;
+            default:
+                return {};
+            }
+            return find_font(Platform::FontPlugin::the().generic_font_name(generic_font));
+        };
 
-    auto family_value = style.property(PropertyID::FontFamily);
-    if (family_value->is_value_list()) {
-        auto const& family_list = static_cast<StyleValueList const&>(*family_value).values();
-        for (auto const& family : family_list) {
-            if (family.is_identifier()) {
-                found_font = find_generic_font(family.to_identifier());
-            } else if (family.is_string()) {
-                found_font = find_font(family.to_string().release_value_but_fixme_should_propagate_errors().to_deprecated_string());
+        if (family_value->is_value_list()) {
+            auto const& family_list = static_cast<StyleValueList const&>(*family_value).values();
+            for (auto const& family : family_list) {
+                if (family.is_identifier()) {
+                    found_font = find_generic_font(family.to_identifier());
+                } else if (family.is_string()) {
+                    found_font = find_font(family.to_string().release_value_but_fixme_should_propagate_errors().to_deprecated_string());
+                }
+                if (found_font)
+                    break;
             }
-            if (found_font)
-                break;
+        } else if (family_value->is_identifier()) {
+            found_font = find_generic_font(family_value->to_identifier());
+        } else if (family_value->is_string()) {
+            found_font = find_font(family_value->to_string().release_value_but_fixme_should_propagate_errors().to_deprecated_string());
         }
-    } else if (family_value->is_identifier()) {
-        found_font = find_generic_font(family_value->to_identifier());
-    } else if (family_value->is_string()) {
-        found_font = find_font(family_value->to_string().release_value_but_fixme_should_propagate_errors().to_deprecated_string());
-    }
 
-    if (!found_font) {
-        found_font = StyleProperties::font_fallback(monospace, bold);
-    }
+        if (!found_font) {
+            found_font = StyleProperties::font_fallback(monospace, bold);
+        }
+
+        FontCache::the().set(font_selector, *found_font);
 
-    FontCache::the().set(font_selector, *found_font);
+        m_font_matching_cache.set(move(font_matching_key), *found_font);
+    }
 
     style.set_property(CSS::PropertyID::FontSize, LengthStyleValue::create(CSS::Length::make_px(font_size_in_px)));
     style.set_property(CSS::PropertyID::FontWeight, NumericStyleValue::create_integer(weight));
@@ -1446,6 +1466,7 @@ CSSPixelRect StyleComputer::viewport_rect() const
 
 void StyleComputer::did_load_font([[maybe_unused]] FlyString const& family_name)
 {
+    m_font_matching_cache.clear();
     document().invalidate_layout();
 }
 
@@ -119,6 +119,25 @@ private:
 
     class FontLoader;
     HashMap<DeprecatedString, NonnullOwnPtr<FontLoader>> m_loaded_fonts;
+
+    struct FontMatchingKey {
+        NonnullRefPtr<StyleValue const> font_family;
+        float font_size_in_px { 0 };
+        int weight { 0 };
+        int slope { 0 };
+
+        bool operator==(FontMatchingKey const& other) const
+        {
+            return font_family.ptr() == other.font_family.ptr() && font_size_in_px == other.font_size_in_px && weight == other.weight && slope == other.slope;
+        }
+    };
+    struct FontMatchingKeyTraits : public GenericTraits<FontMatchingKey> {
+        static unsigned hash(FontMatchingKey const& key)
+        {
+            return pair_int_hash(pair_int_hash(ptr_hash(key.font_family.ptr()), bit_cast<u32>(key.font_size_in_px)), pair_int_hash(key.weight, key.slope));
+        }
+    };
+    mutable HashMap<FontMatchingKey, NonnullRefPtr<Gfx::Font>, FontMatchingKeyTraits> m_font_matching_cache;
 };
 
 }
@@ -679,6 +679,12 @@ Optional<CSS::BoxSizing> StyleProperties::box_sizing() const
     return value_id_to_box_sizing(value->to_identifier());
 }
 
+Optional<CSS::ContentVisibility> StyleProperties::content_visibility() const
+{
+    auto value = property(CSS::PropertyID::ContentVisibility);
+    return value_id_to_content_visibility(value->to_identifier());
+}
+
 Variant<CSS::VerticalAlign, CSS::LengthPercentage> StyleProperties::vertical_align() const
 {
     auto value = property(CSS::PropertyID::VerticalAlign);
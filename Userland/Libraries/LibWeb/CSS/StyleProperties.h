@@ -81,6 +81,7 @@ public:
     Optional<CSS::Overflow> overflow_y() const;
     Vector<CSS::ShadowData> box_shadow() const;
     Optional<CSS::BoxSizing> box_sizing() const;
+    Optional<CSS::ContentVisibility> content_visibility() const;
     Optional<CSS::PointerEvents> pointer_events() const;
     Variant<CSS::VerticalAlign, CSS::LengthPercentage> vertical_align() const;
     Optional<CSS::FontVariant> font_variant() const;
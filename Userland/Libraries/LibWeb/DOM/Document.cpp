@@ -16,6 +16,7 @@
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/MediaQueryList.h>
 #include <LibWeb/CSS/MediaQueryListEvent.h>
+#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
 #include <LibWeb/DOM/Comment.h>
@@ -296,7 +297,10 @@ Document::Document(JS::Realm& realm, const AK::URL& url)
     : ParentNode(realm, *this, NodeType::DOCUMENT_NODE)
     , m_style_computer(make<CSS::StyleComputer>(*this))
     , m_url(url)
+    , m_performance_recorder(make<PerformanceRecorder>())
 {
+    bump_dom_tree_version();
+
     set_prototype(&Bindings::cached_web_prototype(realm, "Document"));
 
     HTML::main_thread_event_loop().register_document({}, *this);
@@ -344,6 +348,11 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_all);
     visitor.visit(m_selection);
     visitor.visit(m_first_base_element_with_href_in_tree_order);
+
+    for (auto& it : m_elements_by_id) {
+        for (auto& element : it.value.elements)
+            visitor.visit(element.ptr());
+    }
     visitor.visit(m_parser);
 
     for (auto& script : m_scripts_to_execute_when_parsing_has_finished)
@@ -706,6 +715,11 @@ void Document::tear_down_layout_tree()
     for (auto& layout_node : layout_nodes) {
         if (layout_node->parent())
             layout_node->parent()->remove_child(*layout_node);
+
+        // NOTE: DOM nodes that don't get a layout node in the next layout tree (e.g. because they're inside an element
+        //       that skips its contents) must not keep pointing into this one.
+        if (auto* dom_node = layout_node->dom_node(); dom_node && dom_node->layout_node() == layout_node.ptr())
+            dom_node->detach_layout_node({});
     }
 
     m_layout_root = nullptr;
@@ -833,34 +847,46 @@ void Document::update_layout()
     if (!browsing_context())
         return;
 
+    PerformanceRecorder::Scope performance_scope(m_performance_recorder.ptr(), PerformancePhase::Layout);
+
     auto viewport_rect = browsing_context()->viewport_rect();
 
-    if (!m_layout_root) {
-        m_next_layout_node_serial_id = 0;
-        Layout::TreeBuilder tree_builder;
-        m_layout_root = verify_cast<Layout::InitialContainingBlock>(*tree_builder.build(*this));
-    }
+    // NOTE: Laying out may move elements with content-visibility: auto towards or away from the viewport, which changes
+    //       whether their contents are skipped, so we rebuild and lay out again until that settles. This is bounded
+    //       since the remembered sizes of laid out elements keep the rest of the page from moving around.
+    static constexpr size_t max_layout_passes_for_content_visibility = 3;
+    for (size_t pass = 0;; ++pass) {
+        if (!m_layout_root) {
+            m_next_layout_node_serial_id = 0;
+            Layout::TreeBuilder tree_builder;
+            m_layout_root = verify_cast<Layout::InitialContainingBlock>(*tree_builder.build(*this));
+        }
 
-    Layout::LayoutState layout_state;
-    layout_state.used_values_per_layout_node.resize(layout_node_count());
+        Layout::LayoutState layout_state;
+        layout_state.used_values_per_layout_node.resize(layout_node_count());
 
-    {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, *m_layout_root, nullptr);
+        {
+            Layout::BlockFormattingContext root_formatting_context(layout_state, *m_layout_root, nullptr);
 
-        auto& icb = static_cast<Layout::InitialContainingBlock&>(*m_layout_root);
-        auto& icb_state = layout_state.get_mutable(icb);
-        icb_state.set_content_width(viewport_rect.width());
-        icb_state.set_content_height(viewport_rect.height());
+            auto& icb = static_cast<Layout::InitialContainingBlock&>(*m_layout_root);
+            auto& icb_state = layout_state.get_mutable(icb);
+            icb_state.set_content_width(viewport_rect.width());
+            icb_state.set_content_height(viewport_rect.height());
 
-        root_formatting_context.run(
-            *m_layout_root,
-            Layout::LayoutMode::Normal,
-            Layout::AvailableSpace(
-                Layout::AvailableSize::make_definite(viewport_rect.width()),
-                Layout::AvailableSize::make_definite(viewport_rect.height())));
-    }
+            root_formatting_context.run(
+                *m_layout_root,
+                Layout::LayoutMode::Normal,
+                Layout::AvailableSpace(
+                    Layout::AvailableSize::make_definite(viewport_rect.width()),
+                    Layout::AvailableSize::make_definite(viewport_rect.height())));
+        }
 
-    layout_state.commit();
+        layout_state.commit();
+
+        if (pass + 1 == max_layout_passes_for_content_visibility || !update_the_relevance_of_content_visibility_auto_elements())
+            break;
+        tear_down_layout_tree();
+    }
 
     browsing_context()->set_needs_display();
 
@@ -873,6 +899,52 @@ void Document::update_layout()
     m_layout_update_timer->stop();
 }
 
+// https://drafts.csswg.org/css-contain-2/#relevant-to-the-user
+// Returns true if the relevance of any element changed, which means the layout tree has to be rebuilt.
+bool Document::update_the_relevance_of_content_visibility_auto_elements()
+{
+    if (!m_layout_root || !browsing_context())
+        return false;
+
+    // An element is close to the viewport if it is within a user-agent defined margin of the viewport. We use 50% of
+    // the viewport's size in each direction, like other engines do.
+    auto viewport_rect = browsing_context()->viewport_rect();
+    auto margin_x = viewport_rect.width() / 2;
+    auto margin_y = viewport_rect.height() / 2;
+    auto close_to_the_viewport_rect = viewport_rect.inflated(margin_x * 2, margin_y * 2);
+
+    bool did_change_relevance = false;
+    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& box) {
+        if (box.computed_values().content_visibility() != CSS::ContentVisibility::Auto || box.is_generated() || !is<Element>(box.dom_node()))
+            return IterationDecision::Continue;
+        auto* paint_box = box.paint_box();
+        if (!paint_box)
+            return IterationDecision::Continue;
+        auto& element = static_cast<Element&>(*box.dom_node());
+
+        // NOTE: Remember the size of every element that was laid out with its contents, so skipping them later
+        //       doesn't change its size.
+        if (!box.skipped_contents_height().has_value())
+            element.set_last_remembered_height({}, paint_box->content_height());
+
+        // NOTE: Skipped boxes are often empty, so we can't use Rect::intersects() here.
+        auto rect = paint_box->absolute_border_box_rect();
+        bool close_to_the_viewport = rect.left() <= close_to_the_viewport_rect.right()
+            && rect.right() >= close_to_the_viewport_rect.left()
+            && rect.top() <= close_to_the_viewport_rect.bottom()
+            && rect.bottom() >= close_to_the_viewport_rect.top();
+
+        // FIXME: The element is also relevant to the user if it or its contents are focused or selected, or placed in
+        //        the top layer.
+        if (close_to_the_viewport != element.is_relevant_to_the_user()) {
+            element.set_relevant_to_the_user({}, close_to_the_viewport);
+            did_change_relevance = true;
+        }
+        return IterationDecision::Continue;
+    });
+    return did_change_relevance;
+}
+
 [[nodiscard]] static bool update_style_recursively(DOM::Node& node)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
@@ -912,6 +984,8 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    PerformanceRecorder::Scope performance_scope(m_performance_recorder.ptr(), PerformancePhase::Style);
+
     evaluate_media_rules();
     if (update_style_recursively(*this))
         invalidate_layout();
@@ -1011,6 +1085,83 @@ void Document::set_hovered_node(Node* node)
     }
 }
 
+// https://dom.spec.whatwg.org/#dom-nonelementparentnode-getelementbyid
+JS::GCPtr<Element> Document::get_element_by_id(FlyString const& id) const
+{
+    // The getElementById(elementId) method steps are to return the first element, in tree order, within this’s descendants, whose ID is elementId; otherwise, if there is no such element, null.
+    auto it = m_elements_by_id.find(id);
+    if (it == m_elements_by_id.end())
+        return nullptr;
+
+    auto& elements = it->value.elements;
+    if (it->value.first_in_tree_order_is_unknown) {
+        size_t first_index = 0;
+        for (size_t i = 1; i < elements.size(); ++i) {
+            if (elements[i]->is_before(*elements[first_index]))
+                first_index = i;
+        }
+        swap(elements[0], elements[first_index]);
+        it->value.first_in_tree_order_is_unknown = false;
+    }
+    return elements.first();
+}
+
+void Document::add_element_to_id_index(Element& element, FlyString const& id)
+{
+    // https://dom.spec.whatwg.org/#concept-id
+    // NOTE: An empty id attribute does not give the element an ID.
+    if (id.is_empty())
+        return;
+
+    auto& entry = m_elements_by_id.ensure(id);
+    entry.elements.append(element);
+    if (entry.elements.size() > 1)
+        entry.first_in_tree_order_is_unknown = true;
+}
+
+void Document::remove_element_from_id_index(Element& element, FlyString const& id)
+{
+    if (id.is_empty())
+        return;
+
+    auto it = m_elements_by_id.find(id);
+    if (it == m_elements_by_id.end())
+        return;
+
+    auto& elements = it->value.elements;
+    auto index = elements.find_first_index(element);
+    if (!index.has_value())
+        return;
+
+    elements.remove(*index);
+    if (elements.is_empty())
+        m_elements_by_id.remove(it);
+    else if (*index == 0)
+        it->value.first_in_tree_order_is_unknown = true;
+}
+
+void Document::bump_dom_tree_version()
+{
+    static u64 s_next_dom_tree_version = 1;
+    m_dom_tree_version = s_next_dom_tree_version++;
+}
+
+Optional<CSS::SelectorList> Document::parse_selector_for_query(StringView selector_text) const
+{
+    if (auto it = m_cached_query_selectors.find(selector_text); it != m_cached_query_selectors.end())
+        return it->value;
+
+    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    if (!maybe_selectors.has_value())
+        return {};
+
+    // NOTE: Scripts that generate selector text could make this grow without bounds, so we simply start over once it's full.
+    if (m_cached_query_selectors.size() >= max_cached_query_selectors)
+        m_cached_query_selectors.clear();
+    m_cached_query_selectors.set(selector_text, maybe_selectors.value());
+    return maybe_selectors;
+}
+
 JS::NonnullGCPtr<HTMLCollection> Document::get_elements_by_name(DeprecatedString const& name)
 {
     return HTMLCollection::create(*this, [name](Element const& element) {
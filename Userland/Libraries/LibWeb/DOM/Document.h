@@ -34,6 +34,7 @@
 #include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowProxy.h>
+#include <LibWeb/PerformanceRecorder.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::DOM {
@@ -194,6 +195,8 @@ public:
     void invalidate_layout();
     void invalidate_stacking_context_tree();
 
+    bool update_the_relevance_of_content_visibility_auto_elements();
+
     virtual bool is_child_allowed(Node const&) const override;
 
     Layout::InitialContainingBlock const* layout_node() const;
@@ -202,6 +205,27 @@ public:
     void schedule_style_update();
     void schedule_layout_update();
 
+    PerformanceRecorder& performance_recorder() { return *m_performance_recorder; }
+    PerformanceRecorder const& performance_recorder() const { return *m_performance_recorder; }
+
+    // NOTE: This hides NonElementParentNode::get_element_by_id(), as we can look the element up in our ID index.
+    JS::GCPtr<Element> get_element_by_id(FlyString const& id) const;
+    JS::GCPtr<Element> get_element_by_id(FlyString const& id) { return const_cast<Document const*>(this)->get_element_by_id(id); }
+
+    // The ID index keeps track of every element in this document's tree that has an ID.
+    void add_element_to_id_index(Element&, FlyString const& id);
+    void remove_element_from_id_index(Element&, FlyString const& id);
+
+    // NOTE: This changes whenever an element is inserted into or removed from this document's node tree (or a
+    //       disconnected subtree whose node document is this), or has one of its attributes changed.
+    //       Versions are unique across documents, so anything derived from a subtree can be cached along with the
+    //       version of its node document at the time.
+    u64 dom_tree_version() const { return m_dom_tree_version; }
+    void bump_dom_tree_version();
+
+    // Parsed selectors for querySelector() and friends, keyed by their text.
+    Optional<CSS::SelectorList> parse_selector_for_query(StringView selector_text) const;
+
     JS::NonnullGCPtr<HTMLCollection> get_elements_by_name(DeprecatedString const&);
     JS::NonnullGCPtr<HTMLCollection> get_elements_by_class_name(FlyString const&);
 
@@ -483,6 +507,8 @@ private:
     Optional<Color> m_visited_link_color;
 
     RefPtr<Platform::Timer> m_style_update_timer;
+
+    NonnullOwnPtr<PerformanceRecorder> m_performance_recorder;
     RefPtr<Platform::Timer> m_layout_update_timer;
 
     JS::GCPtr<HTML::HTMLParser> m_parser;
@@ -611,6 +637,22 @@ private:
 
     // NOTE: This is a cache to make finding the first <base href> element O(1).
     JS::GCPtr<HTML::HTMLBaseElement> m_first_base_element_with_href_in_tree_order;
+
+    // NOTE: This is an index to make getElementById() O(1). Elements sharing an ID are kept in no particular order,
+    //       except that the first one in tree order is moved to the front the next time it is looked up.
+    struct ElementsWithID {
+        Vector<JS::NonnullGCPtr<Element>> elements;
+        bool first_in_tree_order_is_unknown { false };
+    };
+    mutable HashMap<FlyString, ElementsWithID> m_elements_by_id;
+
+    u64 m_dom_tree_version { 0 };
+
+    static constexpr size_t max_cached_query_selectors = 256;
+    mutable HashMap<DeprecatedString, CSS::SelectorList> m_cached_query_selectors;
 };
 
+template<>
+inline bool Node::fast_is<Document>() const { return is_document(); }
+
 }
@@ -80,7 +80,7 @@ void Element::visit_edges(Cell::Visitor& visitor)
 }
 
 // https://dom.spec.whatwg.org/#dom-element-getattribute
-DeprecatedString Element::get_attribute(FlyString const& name) const
+DeprecatedString Element::get_attribute(StringView name) const
 {
     // 1. Let attr be the result of getting an attribute given qualifiedName and this.
     auto const* attribute = m_attributes->get_attribute(name);
@@ -201,7 +201,7 @@ void Element::remove_attribute(FlyString const& name)
 }
 
 // https://dom.spec.whatwg.org/#dom-element-hasattribute
-bool Element::has_attribute(FlyString const& name) const
+bool Element::has_attribute(StringView name) const
 {
     return m_attributes->get_attribute(name) != nullptr;
 }
@@ -360,6 +360,23 @@ void Element::did_remove_attribute(FlyString const& name)
     }
 }
 
+void Element::attribute_changed(FlyString const& local_name, DeprecatedString const& old_value, DeprecatedString const& value)
+{
+    document().bump_dom_tree_version();
+
+    if (local_name == HTML::AttributeNames::id) {
+        if (old_value == value)
+            return;
+
+        // NOTE: Only elements in a document's tree are in its ID index, not those in a shadow tree or a disconnected subtree.
+        if (auto& root = this->root(); is<Document>(root)) {
+            auto& document = static_cast<Document&>(root);
+            document.remove_element_from_id_index(*this, old_value);
+            document.add_element_to_id_index(*this, value);
+        }
+    }
+}
+
 enum class RequiredInvalidation {
     None,
     RepaintOnly,
@@ -456,7 +473,7 @@ DOMTokenList* Element::class_list()
 // https://dom.spec.whatwg.org/#dom-element-matches
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector");
 
@@ -471,7 +488,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 // https://dom.spec.whatwg.org/#dom-element-closest
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector");
 
@@ -1015,6 +1032,31 @@ int Element::scroll_height() const
     return 0;
 }
 
+// https://drafts.csswg.org/css-contain-2/#skips-its-contents
+bool Element::skips_its_contents() const
+{
+    if (!m_computed_css_values)
+        return false;
+
+    // NOTE: Skipping contents implies size containment, which has no effect on non-atomic inline-level boxes and
+    //       internal table boxes.
+    auto display = m_computed_css_values->display();
+    if (display.is_internal() || (display.is_inline_outside() && display.is_flow_inside()))
+        return false;
+
+    switch (m_computed_css_values->content_visibility().value_or(CSS::ContentVisibility::Visible)) {
+    case CSS::ContentVisibility::Visible:
+        return false;
+    // The element skips its contents.
+    case CSS::ContentVisibility::Hidden:
+        return true;
+    // If the element is not relevant to the user, it also skips its contents.
+    case CSS::ContentVisibility::Auto:
+        return !m_relevant_to_the_user;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // https://html.spec.whatwg.org/multipage/semantics-other.html#concept-element-disabled
 bool Element::is_actually_disabled() const
 {
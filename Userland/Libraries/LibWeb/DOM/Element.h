@@ -62,10 +62,10 @@ public:
     // NOTE: This is for the JS bindings
     FlyString const& namespace_uri() const { return namespace_(); }
 
-    bool has_attribute(FlyString const& name) const;
+    bool has_attribute(StringView name) const;
     bool has_attributes() const { return !m_attributes->is_empty(); }
-    DeprecatedString attribute(FlyString const& name) const { return get_attribute(name); }
-    DeprecatedString get_attribute(FlyString const& name) const;
+    DeprecatedString attribute(StringView name) const { return get_attribute(name); }
+    DeprecatedString get_attribute(StringView name) const;
     WebIDL::ExceptionOr<void> set_attribute(FlyString const& name, DeprecatedString const& value);
     WebIDL::ExceptionOr<void> set_attribute_ns(FlyString const& namespace_, FlyString const& qualified_name, DeprecatedString const& value);
     void remove_attribute(FlyString const& name);
@@ -102,6 +102,9 @@ public:
     virtual void parse_attribute(FlyString const& name, DeprecatedString const& value);
     virtual void did_remove_attribute(FlyString const&);
 
+    // https://dom.spec.whatwg.org/#concept-element-attributes-change-ext
+    virtual void attribute_changed(FlyString const& local_name, DeprecatedString const& old_value, DeprecatedString const& value);
+
     enum class NeedsRelayout {
         No = 0,
         Yes = 1,
@@ -171,6 +174,17 @@ public:
     int scroll_width() const;
     int scroll_height() const;
 
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    bool skips_its_contents() const;
+
+    // https://drafts.csswg.org/css-contain-2/#relevant-to-the-user
+    bool is_relevant_to_the_user() const { return m_relevant_to_the_user; }
+    void set_relevant_to_the_user(Badge<Document>, bool relevant) { m_relevant_to_the_user = relevant; }
+
+    // https://drafts.csswg.org/css-sizing-4/#last-remembered
+    Optional<CSSPixels> last_remembered_height() const { return m_last_remembered_height; }
+    void set_last_remembered_height(Badge<Document>, CSSPixels height) { m_last_remembered_height = height; }
+
     bool is_actually_disabled() const;
 
     WebIDL::ExceptionOr<JS::GCPtr<Element>> insert_adjacent_element(DeprecatedString const& where, JS::NonnullGCPtr<Element> element);
@@ -183,7 +197,7 @@ public:
 #define ARIA_IMPL(name, attribute)                                               \
     DeprecatedString name() const override                                       \
     {                                                                            \
-        return get_attribute(attribute);                                         \
+        return get_attribute(attribute##sv);                                     \
     }                                                                            \
                                                                                  \
     WebIDL::ExceptionOr<void> set_##name(DeprecatedString const& value) override \
@@ -279,6 +293,9 @@ private:
     Vector<FlyString> m_classes;
 
     Array<JS::GCPtr<Layout::Node>, to_underlying(CSS::Selector::PseudoElement::PseudoElementCount)> m_pseudo_element_nodes;
+
+    bool m_relevant_to_the_user { false };
+    Optional<CSSPixels> m_last_remembered_height;
 };
 
 template<>
@@ -6,6 +6,7 @@
  */
 
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -31,16 +32,33 @@ void HTMLCollection::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_root.ptr());
+    for (auto& element : m_cached_elements)
+        visitor.visit(element.ptr());
 }
 
-JS::MarkedVector<Element*> HTMLCollection::collect_matching_elements() const
+Vector<JS::NonnullGCPtr<Element>> const& HTMLCollection::cached_matching_elements() const
 {
-    JS::MarkedVector<Element*> elements(m_root->heap());
+    auto dom_tree_version = m_root->document().dom_tree_version();
+    if (m_cached_dom_tree_version == dom_tree_version)
+        return m_cached_elements;
+
+    m_cached_elements.clear_with_capacity();
     m_root->for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
         if (m_filter(element))
-            elements.append(const_cast<Element*>(&element));
+            m_cached_elements.append(const_cast<Element&>(element));
         return IterationDecision::Continue;
     });
+    m_cached_dom_tree_version = dom_tree_version;
+    return m_cached_elements;
+}
+
+JS::MarkedVector<Element*> HTMLCollection::collect_matching_elements() const
+{
+    auto const& cached_elements = cached_matching_elements();
+    JS::MarkedVector<Element*> elements(m_root->heap());
+    elements.ensure_capacity(cached_elements.size());
+    for (auto& element : cached_elements)
+        elements.unchecked_append(element.ptr());
     return elements;
 }
 
@@ -48,14 +66,14 @@ JS::MarkedVector<Element*> HTMLCollection::collect_matching_elements() const
 size_t HTMLCollection::length()
 {
     // The length getter steps are to return the number of nodes represented by the collection.
-    return collect_matching_elements().size();
+    return cached_matching_elements().size();
 }
 
 // https://dom.spec.whatwg.org/#dom-htmlcollection-item
 Element* HTMLCollection::item(size_t index) const
 {
     // The item(index) method steps are to return the indexth element in the collection. If there is no indexth element in the collection, then the method must return null.
-    auto elements = collect_matching_elements();
+    auto const& elements = cached_matching_elements();
     if (index >= elements.size())
         return nullptr;
     return elements[index];
@@ -67,7 +85,7 @@ Element* HTMLCollection::named_item(FlyString const& name) const
     // 1. If key is the empty string, return null.
     if (name.is_empty())
         return nullptr;
-    auto elements = collect_matching_elements();
+    auto const& elements = cached_matching_elements();
     // 2. Return the first element in the collection for which at least one of the following is true:
     //      - it has an ID which is key;
     if (auto it = elements.find_if([&](auto& entry) { return entry->attribute(HTML::AttributeNames::id) == name; }); it != elements.end())
@@ -86,7 +104,7 @@ Vector<DeprecatedString> HTMLCollection::supported_property_names() const
     Vector<DeprecatedString> result;
 
     // 2. For each element represented by the collection, in tree order:
-    auto elements = collect_matching_elements();
+    auto const& elements = cached_matching_elements();
 
     for (auto& element : elements) {
         // 1. If element has an ID which is not in result, append element’s ID to result.
@@ -115,7 +133,7 @@ bool HTMLCollection::is_supported_property_index(u32 index) const
 {
     // The object’s supported property indices are the numbers in the range zero to one less than the number of elements represented by the collection.
     // If there are no such elements, then there are no supported property indices.
-    auto elements = collect_matching_elements();
+    auto const& elements = cached_matching_elements();
     if (elements.is_empty())
         return false;
 
@@ -8,6 +8,7 @@
 
 #include <AK/FlyString.h>
 #include <AK/Function.h>
+#include <AK/Vector.h>
 #include <LibJS/Heap/GCPtr.h>
 #include <LibWeb/Bindings/LegacyPlatformObject.h>
 #include <LibWeb/Forward.h>
@@ -21,9 +22,9 @@ namespace Web::DOM {
 // The filter is a simple Function object that answers the question
 // "is this Element part of the collection?"
 
-// FIXME: HTMLCollection currently does no caching. It will re-filter on every access!
-//        We should teach it how to cache results. The main challenge is invalidating
-//        these caches, since this needs to happen on various kinds of DOM mutation.
+// The matching elements are cached until the DOM tree version of the root's node document changes,
+// which happens on every kind of DOM mutation that could change the result of a filter.
+// NOTE: This means filters must only depend on the tree structure and the attributes of elements.
 
 class HTMLCollection : public Bindings::LegacyPlatformObject {
     WEB_PLATFORM_OBJECT(HTMLCollection, Bindings::LegacyPlatformObject);
@@ -52,8 +53,13 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
+    Vector<JS::NonnullGCPtr<Element>> const& cached_matching_elements() const;
+
     JS::NonnullGCPtr<ParentNode> m_root;
     Function<bool(Element const&)> m_filter;
+
+    mutable Vector<JS::NonnullGCPtr<Element>> m_cached_elements;
+    mutable u64 m_cached_dom_tree_version { 0 };
 };
 
 }
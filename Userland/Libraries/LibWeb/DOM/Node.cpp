@@ -429,6 +429,19 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
         else
             insert_before_impl(*node_to_insert, child);
 
+        document().bump_dom_tree_version();
+
+        // NOTE: If parent is in a document's tree, the inserted elements need to be added to that document's ID index.
+        //       This is done before running the insertion steps, as those may run scripts that look elements up by ID.
+        if (auto& parent_root = root(); is<Document>(parent_root)) {
+            auto& document_with_id_index = static_cast<Document&>(parent_root);
+            node_to_insert->for_each_in_inclusive_subtree_of_type<Element>([&](Element& element) {
+                if (auto id = element.attribute(HTML::AttributeNames::id); !id.is_empty())
+                    document_with_id_index.add_element_to_id_index(element, id);
+                return IterationDecision::Continue;
+            });
+        }
+
         // FIXME: 4. If parent is a shadow host and node is a slottable, then assign a slot for node.
         // FIXME: 5. If parent’s root is a shadow root, and parent is a slot whose assigned nodes is the empty list, then run signal a slot change for parent.
         // FIXME: 6. Run assign slottables for a tree with node’s root.
@@ -557,9 +570,23 @@ void Node::remove(bool suppress_observers)
     // 10. Let oldNextSibling be node’s next sibling.
     JS::GCPtr<Node> old_next_sibling = next_sibling();
 
+    // NOTE: If node was in a document's tree, its elements need to be removed from that document's ID index.
+    auto& root_before_removal = root();
+    auto* document_with_id_index = is<Document>(root_before_removal) ? &static_cast<Document&>(root_before_removal) : nullptr;
+
     // 11. Remove node from its parent’s children.
     parent->remove_child_impl(*this);
 
+    document().bump_dom_tree_version();
+
+    if (document_with_id_index) {
+        for_each_in_inclusive_subtree_of_type<Element>([&](Element& element) {
+            if (auto id = element.attribute(HTML::AttributeNames::id); !id.is_empty())
+                document_with_id_index->remove_element_from_id_index(element, id);
+            return IterationDecision::Continue;
+        });
+    }
+
     // FIXME: 12. If node is assigned, then run assign slottables for node’s assigned slot.
 
     // FIXME: 13. If parent’s root is a shadow root, and parent is a slot whose assigned nodes is the empty list, then run signal a slot change for parent.
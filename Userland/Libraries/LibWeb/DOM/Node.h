@@ -68,6 +68,7 @@ public:
     bool is_attribute() const { return type() == NodeType::ATTRIBUTE_NODE; }
     bool is_cdata_section() const { return type() == NodeType::CDATA_SECTION_NODE; }
     virtual bool is_shadow_root() const { return false; }
+    virtual bool is_dom_node() const final { return true; }
 
     virtual bool requires_svg_container() const { return false; }
     virtual bool is_svg_container() const { return false; }
@@ -661,3 +662,10 @@ private:
 };
 
 }
+
+namespace JS {
+
+template<>
+inline bool Object::fast_is<Web::DOM::Node>() const { return is_dom_node(); }
+
+}
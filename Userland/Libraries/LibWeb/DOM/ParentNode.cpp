@@ -5,7 +5,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/HTMLCollection.h>
@@ -17,13 +16,38 @@
 
 namespace Web::DOM {
 
+// Returns the ID if the selector list is nothing but a single ID selector, like "#foo".
+static FlyString const* lone_id_selector(CSS::SelectorList const& selectors)
+{
+    if (selectors.size() != 1)
+        return nullptr;
+    auto const& selector = selectors.first();
+    if (selector.pseudo_element().has_value() || selector.compound_selectors().size() != 1)
+        return nullptr;
+    auto const& simple_selectors = selector.compound_selectors().first().simple_selectors;
+    if (simple_selectors.size() != 1 || simple_selectors.first().type != CSS::Selector::SimpleSelector::Type::Id)
+        return nullptr;
+    return &simple_selectors.first().name();
+}
+
 WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView selector_text)
 {
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_for_query(selector_text);
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector");
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
+
+    // NOTE: A lone ID selector can be answered from the document's ID index: If the first element in the document
+    //       with that ID is in this subtree, it's also the first one in this subtree. Otherwise, there may still be
+    //       one further down in tree order, unless we are the document itself.
+    if (auto const* id = lone_id_selector(selectors)) {
+        auto element = document().get_element_by_id(*id);
+        if (element && element->is_descendant_of(*this))
+            return element;
+        if (is<Document>(*this))
+            return nullptr;
+    }
 
     JS::GCPtr<Element> result;
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
@@ -42,11 +66,11 @@ WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView se
 
 WebIDL::ExceptionOr<JS::NonnullGCPtr<NodeList>> ParentNode::query_selector_all(StringView selector_text)
 {
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_for_query(selector_text);
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector");
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
 
     Vector<JS::Handle<Node>> elements;
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
@@ -54,6 +78,7 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<NodeList>> ParentNode::query_selector_all(S
         for (auto& selector : selectors) {
             if (SelectorEngine::matches(selector, element)) {
                 elements.append(&element);
+                break;
             }
         }
         return IterationDecision::Continue;
@@ -48,6 +48,6 @@ private:
 };
 
 template<>
-inline bool Node::fast_is<Text>() const { return is_text(); }
+inline bool Node::fast_is<Text>() const { return is_text() || is_cdata_section(); }
 
 }
@@ -8,6 +8,7 @@
 #include <LibJS/Runtime/Completion.h>
 #include <LibWeb/Fetch/BodyInit.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Streams/AbstractOperations.h>
 #include <LibWeb/URL/URLSearchParams.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -41,20 +42,25 @@ WebIDL::ExceptionOr<Infrastructure::BodyWithType> extract_body(JS::Realm& realm,
     }
     // 3. Otherwise, if object is a Blob object, set stream to the result of running object’s get stream.
     else if (auto const* blob_handle = object.get_pointer<JS::Handle<FileAPI::Blob>>()) {
-        // FIXME: "set stream to the result of running object’s get stream"
-        (void)blob_handle;
+        // https://w3c.github.io/FileAPI/#blob-get-stream
+        // NOTE: Blob data is always held in memory, so all of it is enqueued at once rather than read in parallel.
         stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
+        TRY(Streams::set_up_readable_stream(*stream));
+        if (!(*blob_handle)->bytes().is_empty())
+            TRY(Streams::readable_stream_enqueue_bytes(*stream, (*blob_handle)->bytes()));
+        Streams::readable_stream_close_for_other_specifications(*stream);
     }
     // 4. Otherwise, set stream to a new ReadableStream object, and set up stream.
     else {
-        // FIXME: "set up stream"
         stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
+        TRY(Streams::set_up_readable_stream(*stream));
     }
 
     // 5. Assert: stream is a ReadableStream object.
     VERIFY(stream);
 
-    // FIXME: 6. Let action be null.
+    // 6. Let action be null.
+    // NOTE: The only action is returning source, see step 11.
 
     // 7. Let source be null.
     Infrastructure::Body::SourceType source {};
@@ -115,8 +121,21 @@ WebIDL::ExceptionOr<Infrastructure::BodyWithType> extract_body(JS::Realm& realm,
             return {};
         }));
 
-    // FIXME: 11. If source is a byte sequence, then set action to a step that returns source and length to source’s length.
-    // FIXME: 12. If action is non-null, then run these steps in parallel:
+    // 11. If source is a byte sequence, then set action to a step that returns source and length to source’s length.
+    // 12. If action is non-null, then run these steps in parallel:
+    if (auto const* bytes = source.get_pointer<ByteBuffer>()) {
+        length = bytes->size();
+
+        // NOTE: Running the action only returns source, so its steps are run synchronously rather than in parallel.
+        // 1. Run action.
+        //    Whenever one or more bytes are available and stream is not errored, enqueue a Uint8Array wrapping an
+        //    ArrayBuffer containing the available bytes into stream.
+        if (!bytes->is_empty())
+            TRY(Streams::readable_stream_enqueue_bytes(*stream, *bytes));
+
+        //    When running action is done, close stream.
+        Streams::readable_stream_close_for_other_specifications(*stream);
+    }
 
     // 13. Let body be a body whose stream is stream, source is source, and length is length.
     auto body = Infrastructure::Body { JS::make_handle(*stream), move(source), move(length) };
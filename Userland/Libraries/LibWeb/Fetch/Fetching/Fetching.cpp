@@ -8,6 +8,9 @@
 #include <AK/Debug.h>
 #include <AK/ScopeGuard.h>
 #include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/DOM/Document.h>
@@ -37,8 +40,11 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/ReferrerPolicy/AbstractOperations.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/ReadableStreamDefaultController.h>
 #include <LibWeb/URL/URL.h>
 #include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Fetch::Fetching {
 
@@ -645,11 +651,18 @@ WebIDL::ExceptionOr<void> fetch_response_handover(JS::Realm& realm, Infrastructu
                 process_body({});
             });
         }
-        // FIXME: 4. Otherwise, fully read response’s body given processBody, processBodyError, and fetchParams’s task
-        //        destination.
+        // 4. Otherwise, fully read response’s body given processBody, processBodyError, and fetchParams’s task
+        //    destination.
         else {
-            // NOTE: This branch is not taken for JS fetch(), which supplies no 'process response consume body' function.
-            (void)process_body_error;
+            response.body()->fully_read(
+                realm,
+                [process_body = move(process_body)](ByteBuffer bytes) {
+                    process_body(move(bytes));
+                },
+                [process_body_error = move(process_body_error)](JS::Value) {
+                    process_body_error();
+                },
+                task_destination);
         }
     }
 
@@ -1552,17 +1565,18 @@ static void log_load_request(auto const& load_request)
         dbgln("> {}", line);
 }
 
-static void log_response(auto const& status_code, auto const& headers, auto const& data)
+static void log_response(auto const& status_code, auto const& headers)
 {
     dbgln("< HTTP/1.1 {}", status_code.value_or(0));
     for (auto const& [name, value] : headers)
         dbgln("< {}: {}", name, value);
     dbgln("<");
-    for (auto line : StringView { data }.split_view('\n', SplitBehavior::KeepEmpty))
-        dbgln("< {}", line);
 }
 #endif
 
+// NOTE: How many bytes of a response body are read from the network ahead of the stream's reader.
+static constexpr double response_body_high_water_mark = 1 * MiB;
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_loader_http_network_fetch(JS::Realm& realm, Infrastructure::FetchParams const& fetch_params, IncludeCredentials include_credentials, IsNewConnectionFetch is_new_connection_fetch)
@@ -1601,35 +1615,84 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
     if constexpr (WEB_FETCH_DEBUG)
         log_load_request(load_request);
 
-    ResourceLoader::the().load(
+    // NOTE: The response body is not buffered, it is streamed into a ReadableStream as its bytes arrive from the
+    //       network. Reading from the connection is paused whenever the stream's queue is full, and resumed when
+    //       the stream is pulled from again.
+    struct StreamingState : public RefCounted<StreamingState> {
+        RefPtr<ResourceLoaderConnectorRequest> request;
+        JS::Handle<Streams::ReadableStream> stream;
+        bool resolved { false };
+    };
+    auto state = adopt_ref(*new StreamingState);
+
+    auto request_or_null = ResourceLoader::the().load_unbuffered(
         load_request,
-        [&realm, &vm, request, pending_response](auto data, auto& response_headers, auto status_code) {
-            dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' complete", request->url());
+        [&realm, &vm, request, pending_response, state](auto& response_headers, auto status_code) {
+            dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader received headers for '{}'", request->url());
             if constexpr (WEB_FETCH_DEBUG)
-                log_response(status_code, response_headers, data);
-            auto [body, _] = MUST(extract_body(realm, data));
+                log_response(status_code, response_headers);
+
+            auto stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
+            auto pull_algorithm = [&realm, state]() -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+                if (state->request)
+                    state->request->set_reading_paused(false);
+                return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+            };
+            auto cancel_algorithm = [&realm, state](JS::Value) -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+                if (state->request)
+                    state->request->stop();
+                state->stream = {};
+                return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+            };
+            auto size_algorithm = [](JS::Value chunk) -> double {
+                return static_cast<double>(verify_cast<JS::Uint8Array>(chunk.as_object()).byte_length());
+            };
+            MUST(Streams::set_up_readable_stream(*stream, move(pull_algorithm), move(cancel_algorithm), response_body_high_water_mark, move(size_algorithm)));
+            state->stream = JS::make_handle(*stream);
+
             auto response = Infrastructure::Response::create(vm);
             response->set_status(status_code.value_or(200));
-            response->set_body(move(body));
+            response->set_body(Infrastructure::Body { JS::make_handle(*stream) });
             for (auto const& [name, value] : response_headers) {
                 auto header = Infrastructure::Header::from_string_pair(name, value).release_value_but_fixme_should_propagate_errors();
                 response->header_list()->append(header).release_value_but_fixme_should_propagate_errors();
             }
             // FIXME: Set response status message
+            state->resolved = true;
             pending_response->resolve(response);
         },
-        [&vm, request, pending_response](auto& error, auto status_code) {
-            dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' failed: {} (status {})", request->url(), error, status_code.value_or(0));
-            auto response = Infrastructure::Response::create(vm);
-            // FIXME: This is ugly, ResourceLoader should tell us.
-            if (status_code.value_or(0) == 0) {
-                response = Infrastructure::Response::network_error(vm, "HTTP request failed"sv);
-            } else {
-                response->set_status(status_code.value_or(200));
-                // FIXME: Set response status message and body
+        [state](ReadonlyBytes data) {
+            if (!state->stream)
+                return;
+            auto& stream = *state->stream;
+            if (Streams::readable_stream_enqueue_bytes(stream, data).is_error()) {
+                // NOTE: The only way for this to fail is running out of memory for the chunk.
+                Streams::readable_stream_error_for_other_specifications(stream, JS::InternalError::create(stream.realm(), "Out of memory while reading response body"sv));
+                return;
             }
-            pending_response->resolve(response);
+            auto desired_size = Streams::readable_stream_default_controller_get_desired_size(*stream.controller());
+            if (state->request && desired_size.has_value() && *desired_size <= 0)
+                state->request->set_reading_paused(true);
+        },
+        [&vm, request, pending_response, state](bool success, auto error_message) {
+            dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' {}: {}", request->url(), success ? "complete"sv : "failed"sv, error_message.value_or(""sv));
+
+            if (!state->resolved) {
+                state->resolved = true;
+                pending_response->resolve(Infrastructure::Response::network_error(vm, "HTTP request failed"sv));
+            } else if (state->stream) {
+                auto& stream = *state->stream;
+                if (success)
+                    Streams::readable_stream_close_for_other_specifications(stream);
+                else
+                    Streams::readable_stream_error_for_other_specifications(stream, JS::TypeError::create(stream.realm(), "Network error while reading response body"sv));
+            }
+
+            // NOTE: Break the reference cycle between the stream's algorithms and the stream.
+            state->request = nullptr;
+            state->stream = {};
         });
+    state->request = move(request_or_null);
 
     return pending_response;
 }
@@ -5,9 +5,13 @@
  */
 
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Fetch/BodyInit.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/Task.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/ReadableStreamDefaultReader.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Fetch::Infrastructure {
@@ -32,27 +36,77 @@ WebIDL::ExceptionOr<Body> Body::clone() const
     auto& vm = Bindings::main_thread_vm();
     auto& realm = *vm.current_realm();
 
-    // FIXME: 1. Let « out1, out2 » be the result of teeing body’s stream.
-    // FIXME: 2. Set body’s stream to out1.
-    auto out2 = vm.heap().allocate<Streams::ReadableStream>(realm, realm);
+    // 1. Let « out1, out2 » be the result of teeing body’s stream.
+    auto branches = TRY(Streams::readable_stream_default_tee(realm, *m_stream));
+    auto out1 = branches[0];
+    auto out2 = branches[1];
+
+    // 2. Set body’s stream to out1.
+    // NOTE: Cloning a body replaces its stream, which is not observable otherwise.
+    const_cast<Body&>(*this).m_stream = JS::make_handle(out1);
 
     // 3. Return a body whose stream is out2 and other members are copied from body.
     return Body { JS::make_handle(out2), m_source, m_length };
 }
 
+// https://fetch.spec.whatwg.org/#body-fully-read
+void Body::fully_read(JS::Realm& realm, ProcessBodyCallback process_body, ProcessBodyErrorCallback process_body_error, JS::NonnullGCPtr<JS::Object> task_destination) const
+{
+    // FIXME: 1. If taskDestination is null, then set taskDestination to the result of starting a new parallel queue.
+
+    // 2. Let successSteps given a byte sequence bytes be to queue a fetch task to run processBody given bytes, with
+    //    taskDestination.
+    auto success_steps = [process_body = move(process_body), task_destination](ByteBuffer bytes) mutable {
+        queue_fetch_task(*task_destination, [process_body = move(process_body), bytes = move(bytes)]() mutable {
+            process_body(move(bytes));
+        });
+    };
+
+    // 3. Let errorSteps be to queue a fetch task to run processBodyError, with taskDestination.
+    auto error_steps = [process_body_error = move(process_body_error), task_destination](JS::Value error) mutable {
+        queue_fetch_task(*task_destination, [process_body_error = move(process_body_error), error = JS::make_handle(error)]() mutable {
+            process_body_error(error.value());
+        });
+    };
+
+    // 4. Let reader be the result of getting a reader for body’s stream. If that threw an exception, then run
+    //    errorSteps with that exception and return.
+    auto reader = Streams::acquire_readable_stream_default_reader(*m_stream);
+    if (reader.is_exception()) {
+        auto throw_completion = Bindings::Detail::dom_exception_to_throw_completion(realm.vm(), reader.release_error());
+        error_steps(*throw_completion.release_value());
+        return;
+    }
+
+    // 5. Read all bytes from reader, given successSteps and errorSteps.
+    reader.value()->read_all_bytes(move(success_steps), move(error_steps));
+}
+
 // https://fetch.spec.whatwg.org/#fully-reading-body-as-promise
 JS::NonnullGCPtr<JS::PromiseCapability> Body::fully_read_as_promise() const
 {
     auto& vm = Bindings::main_thread_vm();
     auto& realm = *vm.current_realm();
 
-    // FIXME: Implement the streams spec - this is completely made up for now :^)
-    if (auto const* byte_buffer = m_source.get_pointer<ByteBuffer>()) {
-        auto result = DeprecatedString::copy(*byte_buffer);
-        return WebIDL::create_resolved_promise(realm, JS::PrimitiveString::create(vm, move(result)));
+    // 1. Let reader be the result of getting a reader for body’s stream. If that threw an exception, then return a
+    //    promise rejected with that exception.
+    auto reader = Streams::acquire_readable_stream_default_reader(*m_stream);
+    if (reader.is_exception()) {
+        auto throw_completion = Bindings::Detail::dom_exception_to_throw_completion(vm, reader.release_error());
+        return WebIDL::create_rejected_promise(realm, *throw_completion.release_value());
     }
-    // Empty, Blob, FormData
-    return WebIDL::create_rejected_promise(realm, JS::InternalError::create(realm, "Reading body isn't fully implemented"sv));
+
+    // 2. Return the result of reading all bytes from reader.
+    // FIXME: The promise should be resolved with the bytes, not with a string made from them.
+    auto promise = WebIDL::create_promise(realm);
+    reader.value()->read_all_bytes(
+        [&vm, promise](ByteBuffer bytes) {
+            WebIDL::resolve_promise(vm, *promise, JS::PrimitiveString::create(vm, DeprecatedString::copy(bytes)));
+        },
+        [&vm, promise](JS::Value error) {
+            WebIDL::reject_promise(vm, *promise, error);
+        });
+    return promise;
 }
 
 // https://fetch.spec.whatwg.org/#byte-sequence-as-a-body
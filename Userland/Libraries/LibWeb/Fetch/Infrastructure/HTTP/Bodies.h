@@ -12,6 +12,7 @@
 #include <AK/Optional.h>
 #include <AK/Variant.h>
 #include <LibJS/Heap/Handle.h>
+#include <LibJS/SafeFunction.h>
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/Streams/ReadableStream.h>
 
@@ -21,6 +22,8 @@ namespace Web::Fetch::Infrastructure {
 class Body final {
 public:
     using SourceType = Variant<Empty, ByteBuffer, JS::Handle<FileAPI::Blob>>;
+    using ProcessBodyCallback = JS::SafeFunction<void(ByteBuffer)>;
+    using ProcessBodyErrorCallback = JS::SafeFunction<void(JS::Value)>;
 
     explicit Body(JS::Handle<Streams::ReadableStream>);
     Body(JS::Handle<Streams::ReadableStream>, SourceType, Optional<u64>);
@@ -31,6 +34,7 @@ public:
 
     [[nodiscard]] WebIDL::ExceptionOr<Body> clone() const;
 
+    void fully_read(JS::Realm&, ProcessBodyCallback process_body, ProcessBodyErrorCallback process_body_error, JS::NonnullGCPtr<JS::Object> task_destination) const;
     [[nodiscard]] JS::NonnullGCPtr<JS::PromiseCapability> fully_read_as_promise() const;
 
 private:
@@ -374,6 +374,10 @@ struct BorderRadiiData;
 struct LinearGradientData;
 }
 
+namespace Web::PerformanceTimeline {
+class PerformanceEntry;
+}
+
 namespace Web::Platform {
 class Timer;
 }
@@ -396,6 +400,9 @@ class Selection;
 
 namespace Web::Streams {
 class ReadableStream;
+class ReadableStreamDefaultController;
+class ReadableStreamDefaultReader;
+class ReadRequest;
 }
 
 namespace Web::SVG {
@@ -491,6 +498,12 @@ class URLSearchParams;
 class URLSearchParamsIterator;
 }
 
+namespace Web::UserTiming {
+class PerformanceMark;
+class PerformanceMeasure;
+struct PerformanceMarkOptions;
+}
+
 namespace Web::Bindings {
 class Intrinsics;
 class LocationObject;
@@ -334,6 +334,11 @@ void BrowsingContext::set_viewport_rect(CSSPixelRect const& rect)
         m_viewport_scroll_offset = rect.location();
         scroll_offset_did_change();
         did_change = true;
+
+        // NOTE: Scrolling may have brought elements with content-visibility: auto close to the viewport (or moved them
+        //       away from it), in which case their contents have to be laid out (or can be skipped).
+        if (auto* document = active_document(); document && document->update_the_relevance_of_content_visibility_auto_elements())
+            document->invalidate_layout();
     }
 
     if (did_change) {
@@ -9,6 +9,7 @@
 #include <LibGfx/Painter.h>
 #include <LibGfx/Quad.h>
 #include <LibGfx/Rect.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
@@ -276,6 +277,18 @@ void CanvasRenderingContext2D::fill(Path2D& path, DeprecatedString const& fill_r
     return fill_internal(transformed_path, fill_rule);
 }
 
+// NOTE: Both the canvas bitmap and ImageData hold unpremultiplied pixels, so converting between them is only a matter of
+//       swapping the red and blue channels. This loop is simple enough for the compiler to vectorize.
+static void convert_bgra8888_to_rgba8888(u32 const* source, u32* target, size_t pixel_count)
+{
+    for (size_t i = 0; i < pixel_count; ++i) {
+        u32 bgra = source[i];
+        target[i] = (bgra & 0xff00ff00)
+            | ((bgra & 0x000000ff) << 16)
+            | ((bgra & 0x00ff0000) >> 16);
+    }
+}
+
 JS::GCPtr<ImageData> CanvasRenderingContext2D::create_image_data(int width, int height) const
 {
     return ImageData::create_with_size(realm(), width, height);
@@ -306,12 +319,13 @@ WebIDL::ExceptionOr<JS::GCPtr<ImageData>> CanvasRenderingContext2D::get_image_da
     auto source_rect_intersected = source_rect.intersected(bitmap.rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
-    // FIXME: Can't use a Gfx::Painter + blit() here as it doesn't support ImageData bitmap's RGBA8888 format.
-    for (int target_y = 0; target_y < source_rect_intersected.height(); ++target_y) {
-        for (int target_x = 0; target_x < source_rect_intersected.width(); ++target_x) {
-            auto pixel = bitmap.get_pixel(target_x + x, target_y + y);
-            image_data->bitmap().set_pixel(target_x, target_y, pixel);
-        }
+    // NOTE: Gfx::Painter can't paint into ImageData's RGBA8888 bitmap, so we convert the pixels one row at a time ourselves.
+    VERIFY(bitmap.format() == Gfx::BitmapFormat::BGRA8888);
+    auto& target_bitmap = image_data->bitmap();
+    for (int source_y = source_rect_intersected.top(); source_y <= source_rect_intersected.bottom(); ++source_y) {
+        auto const* source = bitmap.scanline(source_y) + source_rect_intersected.left();
+        auto* target = target_bitmap.scanline(source_y - y) + (source_rect_intersected.left() - x);
+        convert_bgra8888_to_rgba8888(source, target, source_rect_intersected.width());
     }
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
@@ -321,15 +335,25 @@ WebIDL::ExceptionOr<JS::GCPtr<ImageData>> CanvasRenderingContext2D::get_image_da
     return image_data;
 }
 
-void CanvasRenderingContext2D::put_image_data(ImageData const& image_data, float x, float y)
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData const& image_data, float x, float y)
 {
+    // 1. If imagedata's data attribute value's [[ViewedArrayBuffer]] internal slot is detached, then throw an "InvalidStateError" DOMException.
+    // NOTE: The bitmap of imagedata points into that buffer, so this also keeps us from reading freed memory.
+    if (image_data.data()->viewed_array_buffer()->is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "ImageData's underlying buffer has been detached");
+
     auto painter = this->painter();
     if (!painter)
-        return;
+        return {};
 
-    painter->blit(Gfx::IntPoint(x, y), image_data.bitmap(), image_data.bitmap().rect());
+    // NOTE: The pixels are written to the output bitmap as they are, without being affected by the current transformation matrix,
+    //       shadow attributes, global alpha, clipping region, or compositing operator. Not applying alpha makes blit() copy the
+    //       rows with a plain RGBA to BGRA conversion.
+    painter->blit(Gfx::IntPoint(x, y), image_data.bitmap(), image_data.bitmap().rect(), 1.0f, false);
 
     did_draw(Gfx::FloatRect(x, y, image_data.width(), image_data.height()));
+    return {};
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
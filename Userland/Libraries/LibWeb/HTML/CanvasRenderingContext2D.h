@@ -73,7 +73,7 @@ public:
 
     virtual JS::GCPtr<ImageData> create_image_data(int width, int height) const override;
     virtual WebIDL::ExceptionOr<JS::GCPtr<ImageData>> get_image_data(int x, int y, int width, int height) const override;
-    virtual void put_image_data(ImageData const&, float x, float y) override;
+    virtual WebIDL::ExceptionOr<void> put_image_data(ImageData const&, float x, float y) override;
 
     virtual void reset_to_default_state() override;
 
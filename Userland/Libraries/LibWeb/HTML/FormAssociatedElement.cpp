@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/HTML/FormAssociatedElement.h>
 #include <LibWeb/HTML/HTMLButtonElement.h>
 #include <LibWeb/HTML/HTMLFieldSetElement.h>
@@ -103,14 +105,15 @@ void FormAssociatedElement::reset_form_owner()
     if (is_listed() && html_element.has_attribute(HTML::AttributeNames::form) && html_element.is_connected()) {
         // 1. If the first element in element's tree, in tree order, to have an ID that is identical to element's form content attribute's value, is a form element, then associate the element with that form element.
         auto form_value = html_element.attribute(HTML::AttributeNames::form);
-        html_element.root().for_each_in_inclusive_subtree_of_type<HTMLFormElement>([this, &form_value](HTMLFormElement& form_element) {
-            if (form_element.attribute(HTML::AttributeNames::id) == form_value) {
-                set_form(&form_element);
-                return IterationDecision::Break;
-            }
-
-            return IterationDecision::Continue;
-        });
+        auto& root = html_element.root();
+        JS::GCPtr<DOM::Element> element_with_id;
+        if (is<DOM::Document>(root))
+            element_with_id = static_cast<DOM::Document&>(root).get_element_by_id(form_value);
+        else if (is<DOM::DocumentFragment>(root))
+            element_with_id = static_cast<DOM::DocumentFragment&>(root).get_element_by_id(form_value);
+
+        if (is<HTMLFormElement>(element_with_id.ptr()))
+            set_form(static_cast<HTMLFormElement*>(element_with_id.ptr()));
     }
 
     // 5. Otherwise, if element has an ancestor form element, then associate element with the nearest such ancestor form element.
@@ -875,7 +875,7 @@ FlyString HTMLInputElement::default_role() const
     if (type_state() == TypeAttributeState::Checkbox)
         return DOM::ARIARoleNames::checkbox;
     // https://www.w3.org/TR/html-aria/#el-input-email
-    if (type_state() == TypeAttributeState::Email && attribute("list").is_null())
+    if (type_state() == TypeAttributeState::Email && attribute("list"sv).is_null())
         return DOM::ARIARoleNames::textbox;
     // https://www.w3.org/TR/html-aria/#el-input-image
     if (type_state() == TypeAttributeState::ImageButton)
@@ -898,10 +898,10 @@ FlyString HTMLInputElement::default_role() const
             || type_state() == TypeAttributeState::Telephone
             || type_state() == TypeAttributeState::URL
             || type_state() == TypeAttributeState::Email)
-        && !attribute("list").is_null())
+        && !attribute("list"sv).is_null())
         return DOM::ARIARoleNames::combobox;
     // https://www.w3.org/TR/html-aria/#el-input-search
-    if (type_state() == TypeAttributeState::Search && attribute("list").is_null())
+    if (type_state() == TypeAttributeState::Search && attribute("list"sv).is_null())
         return DOM::ARIARoleNames::textbox;
     // https://www.w3.org/TR/html-aria/#el-input-submit
     if (type_state() == TypeAttributeState::SubmitButton)
@@ -910,10 +910,10 @@ FlyString HTMLInputElement::default_role() const
     if (type_state() == TypeAttributeState::Telephone)
         return DOM::ARIARoleNames::textbox;
     // https://www.w3.org/TR/html-aria/#el-input-text
-    if (type_state() == TypeAttributeState::Text && attribute("list").is_null())
+    if (type_state() == TypeAttributeState::Text && attribute("list"sv).is_null())
         return DOM::ARIARoleNames::textbox;
     // https://www.w3.org/TR/html-aria/#el-input-url
-    if (type_state() == TypeAttributeState::URL && attribute("list").is_null())
+    if (type_state() == TypeAttributeState::URL && attribute("list"sv).is_null())
         return DOM::ARIARoleNames::textbox;
 
     // https://www.w3.org/TR/html-aria/#el-input-color
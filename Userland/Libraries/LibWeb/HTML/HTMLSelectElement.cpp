@@ -159,10 +159,10 @@ DeprecatedString const& HTMLSelectElement::type() const
 FlyString HTMLSelectElement::default_role() const
 {
     // https://www.w3.org/TR/html-aria/#el-select-multiple-or-size-greater-1
-    if (has_attribute("multiple"))
+    if (has_attribute("multiple"sv))
         return DOM::ARIARoleNames::listbox;
-    if (has_attribute("size")) {
-        auto size_attribute = attribute("size").to_int();
+    if (has_attribute("size"sv)) {
+        auto size_attribute = attribute("size"sv).to_int();
         if (size_attribute.has_value() && size_attribute.value() > 1)
             return DOM::ARIARoleNames::listbox;
     }
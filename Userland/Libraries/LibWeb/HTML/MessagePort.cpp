@@ -11,6 +11,7 @@
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/MessageEvent.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
 
 namespace Web::HTML {
 
@@ -58,42 +59,63 @@ void MessagePort::entangle_with(MessagePort& remote_port)
 }
 
 // https://html.spec.whatwg.org/multipage/web-messaging.html#dom-messageport-postmessage
-void MessagePort::post_message(JS::Value message)
+WebIDL::ExceptionOr<void> MessagePort::post_message(JS::Value message, Vector<JS::Handle<JS::Object>> const& transfer)
 {
     // 1. Let targetPort be the port with which this MessagePort is entangled, if any; otherwise let it be null.
     auto* target_port = m_remote_port.ptr();
 
-    // FIXME: 2. Let options be «[ "transfer" → transfer ]».
-
+    // 2. Let options be «[ "transfer" → transfer ]».
     // 3. Run the message port post message steps providing targetPort, message and options.
 
     // https://html.spec.whatwg.org/multipage/web-messaging.html#message-port-post-message-steps
 
-    // FIXME: 1. Let transfer be options["transfer"].
+    // 1. Let transfer be options["transfer"].
 
-    // FIXME: 2. If transfer contains this MessagePort, then throw a "DataCloneError" DOMException.
+    // 2. If transfer contains this MessagePort, then throw a "DataCloneError" DOMException.
+    // NOTE: We can't transfer MessagePorts yet, so StructuredSerializeWithTransfer throws for any MessagePort in transfer.
 
     // 3. Let doomed be false.
     bool doomed = false;
 
     // FIXME: 4. If targetPort is not null and transfer contains targetPort, then set doomed to true and optionally report to a developer console that the target port was posted to itself, causing the communication channel to be lost.
 
-    // FIXME: 5. Let serializeWithTransferResult be StructuredSerializeWithTransfer(message, transfer). Rethrow any exceptions.
+    // 5. Let serializeWithTransferResult be StructuredSerializeWithTransfer(message, transfer). Rethrow any exceptions.
+    auto serialize_with_transfer_result = TRY(structured_serialize_with_transfer(vm(), message, transfer));
 
     // 6. If targetPort is null, or if doomed is true, then return.
     if (!target_port || doomed)
-        return;
+        return {};
+
+    // 7. Add a task that runs the following steps to the port message queue of targetPort:
+    // FIXME: Use the port message queue of targetPort instead of the main thread event loop's task queue.
+    main_thread_event_loop().task_queue().add(HTML::Task::create(HTML::Task::Source::PostedMessage, nullptr, [target_port, serialize_with_transfer_result = move(serialize_with_transfer_result)]() mutable {
+        // 1. Let finalTargetPort be the MessagePort in whose port message queue the task now finds itself.
+        // NOTE: This can be different from targetPort, if targetPort itself was transferred and thus all its tasks moved along with it.
+
+        // 2. Let targetRealm be finalTargetPort's relevant realm.
+        auto& target_realm = target_port->realm();
 
-    // FIXME: 7. Add a task that runs the following steps to the port message queue of targetPort:
+        // 3. Let deserializeRecord be StructuredDeserializeWithTransfer(serializeWithTransferResult, targetRealm).
+        // NOTE: The message is deserialized into the target port's own heap, so no JS value is ever shared between two VMs.
+        auto deserialize_record = structured_deserialize_with_transfer(target_port->vm(), serialize_with_transfer_result, target_realm);
 
-    // FIXME: This is an ad-hoc hack implementation instead, since we don't currently
-    //        have serialization and deserialization of messages.
-    main_thread_event_loop().task_queue().add(HTML::Task::create(HTML::Task::Source::PostedMessage, nullptr, [target_port, message] {
+        // 4. If this throws an exception, catch it, fire an event named messageerror at finalTargetPort, using MessageEvent, and then return.
+        if (deserialize_record.is_exception()) {
+            target_port->dispatch_event(*MessageEvent::create(target_realm, HTML::EventNames::messageerror));
+            return;
+        }
+
+        // 5. Let messageClone be deserializeRecord.[[Deserialized]].
+        // FIXME: 6. Let newPorts be a new frozen array consisting of all MessagePort objects in deserializeRecord.[[TransferredValues]], if any, maintaining their relative order.
+
+        // 7. Fire an event named message at finalTargetPort, using MessageEvent, with the data attribute initialized to messageClone and the ports attribute initialized to newPorts.
         MessageEventInit event_init {};
-        event_init.data = message;
+        event_init.data = deserialize_record.release_value();
         event_init.origin = "<origin>";
-        target_port->dispatch_event(*MessageEvent::create(target_port->realm(), HTML::EventNames::message, event_init));
+        target_port->dispatch_event(*MessageEvent::create(target_realm, HTML::EventNames::message, event_init));
     }));
+
+    return {};
 }
 
 void MessagePort::start()
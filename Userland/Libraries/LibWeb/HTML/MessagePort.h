@@ -10,6 +10,7 @@
 #include <AK/Weakable.h>
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
 
@@ -30,7 +31,7 @@ public:
     void entangle_with(MessagePort&);
 
     // https://html.spec.whatwg.org/multipage/web-messaging.html#dom-messageport-postmessage
-    void post_message(JS::Value);
+    WebIDL::ExceptionOr<void> post_message(JS::Value, Vector<JS::Handle<JS::Object>> const& transfer = {});
 
     void start();
 
@@ -160,6 +160,8 @@ void HTMLParser::visit_edges(Cell::Visitor& visitor)
 
 void HTMLParser::run()
 {
+    PerformanceRecorder::Scope performance_scope(&m_document->performance_recorder(), PerformancePhase::Parsing);
+
     for (;;) {
         // FIXME: Find a better way to say that we come from Document::close() and want to process EOF.
         if (!m_tokenizer.is_eof_inserted() && m_tokenizer.is_insertion_point_reached())
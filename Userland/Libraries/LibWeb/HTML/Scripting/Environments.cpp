@@ -101,6 +101,9 @@ void EnvironmentSettingsObject::prepare_to_run_script()
     global_object().vm().push_execution_context(realm_execution_context());
 
     // FIXME: 2. Add settings to the currently running task's script evaluation environment settings object set.
+
+    if (auto document = responsible_document())
+        document->performance_recorder().begin(PerformancePhase::Script);
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#clean-up-after-running-script
@@ -117,6 +120,10 @@ void EnvironmentSettingsObject::clean_up_after_running_script()
     // 3. If the JavaScript execution context stack is now empty, perform a microtask checkpoint. (If this runs scripts, these algorithms will be invoked reentrantly.)
     if (vm.execution_context_stack().is_empty())
         responsible_event_loop().perform_a_microtask_checkpoint();
+
+    // NOTE: This is done after the microtask checkpoint so that a long task includes the microtasks it queued.
+    if (auto document = responsible_document())
+        document->performance_recorder().end(PerformancePhase::Script);
 }
 
 static JS::ExecutionContext* top_most_script_having_execution_context(JS::VM& vm)
@@ -6,18 +6,24 @@
  */
 
 #include <AK/HashTable.h>
+#include <AK/TypeCasts.h>
 #include <AK/Vector.h>
 #include <LibJS/Forward.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Utf16String.h>
+#include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
 
 // Binary format:
-// A list of adjacent shallow values, which may contain references to other
-// values (noted by their position in the list, one value following another).
-// This list represents the "memory" in the StructuredSerialize algorithm.
-// The first item in the list is the root, i.e., the value of everything.
+// A list of values in depth-first order, starting with the root, i.e., the value of everything.
+// Objects are numbered in the order in which they first appear; any further occurrence of the
+// same object (including circular ones) is written as a reference to that number instead.
 // The format is generally u32-aligned (hence this leaking out into the type)
 // Each value has a length based on its type, as defined below.
 //
@@ -27,96 +33,293 @@ enum ValueTag {
     // Unused, for ease of catching bugs
     Empty,
 
+    // No following data
+    UndefinedPrimitive,
+    NullPrimitive,
+
+    // Following u32 is the boolean value
+    BooleanPrimitive,
+
     // Following two u32s are the double value
     NumberPrimitive,
 
-    // TODO: Define many more types
+    // Following u32 is the number of UTF-16 code units, followed by the code units packed into u32s
+    StringPrimitive,
+
+    // Following u32 is the byte length, followed by the bytes packed into u32s
+    ArrayBuffer,
+
+    // Following u32 is the index into the transfer data holders
+    TransferredArrayBuffer,
+
+    // Following u32 is the length, then the property count, then that many (string, value) pairs
+    Array,
+
+    // Following u32 is the property count, then that many (string, value) pairs
+    Object,
+
+    // Following u32 is the number of an object that appeared earlier
+    ObjectReference,
 
     // This tag or higher are understood to be errors
     ValueTagMax,
 };
 
-// Serializing and deserializing are each two passes:
-// 1. Fill up the memory with all the values, but without translating references
-// 2. Translate all the references into the appropriate form
-
 class Serializer {
 public:
-    Serializer(JS::VM& vm)
+    Serializer(JS::VM& vm, HashMap<JS::ArrayBuffer const*, u32> transfer_indices = {})
         : m_vm(vm)
+        , m_transfer_indices(move(transfer_indices))
     {
     }
 
-    void serialize(JS::Value value)
+    WebIDL::ExceptionOr<void> serialize(JS::Value value)
     {
-        if (value.is_number()) {
+        if (value.is_undefined()) {
+            m_serialized.append(ValueTag::UndefinedPrimitive);
+        } else if (value.is_null()) {
+            m_serialized.append(ValueTag::NullPrimitive);
+        } else if (value.is_boolean()) {
+            m_serialized.append(ValueTag::BooleanPrimitive);
+            m_serialized.append(value.as_bool());
+        } else if (value.is_number()) {
             m_serialized.append(ValueTag::NumberPrimitive);
             double number = value.as_double();
             m_serialized.append(bit_cast<u32*>(&number), 2);
+        } else if (value.is_string()) {
+            m_serialized.append(ValueTag::StringPrimitive);
+            TRY(serialize_string(value.as_string()));
+        } else if (value.is_object()) {
+            TRY(serialize_object(value.as_object()));
         } else {
             // TODO: Define many more types
-            m_error = "Unsupported type"sv;
+            return error("Unsupported type"sv);
         }
+        return {};
     }
 
-    WebIDL::ExceptionOr<Vector<u32>> result()
+    SerializationRecord result() { return move(m_serialized); }
+
+private:
+    WebIDL::ExceptionOr<void> serialize_string(JS::PrimitiveString const& string)
     {
-        if (m_error.is_null())
-            return m_serialized;
-        return throw_completion(WebIDL::DataCloneError::create(*m_vm.current_realm(), m_error));
+        auto const& code_units = TRY(string.utf16_string()).string();
+        m_serialized.append(code_units.size());
+        for (size_t i = 0; i < code_units.size(); i += 2) {
+            u32 packed = code_units[i];
+            if (i + 1 < code_units.size())
+                packed |= static_cast<u32>(code_units[i + 1]) << 16;
+            m_serialized.append(packed);
+        }
+        return {};
+    }
+
+    WebIDL::ExceptionOr<void> serialize_object(JS::Object& object)
+    {
+        // If memory[value] exists, then return CreateRecord({ [[Type]]: "ref", [[Value]]: memory[value] }).
+        if (auto id = m_object_ids.get(&object); id.has_value()) {
+            m_serialized.append(ValueTag::ObjectReference);
+            m_serialized.append(*id);
+            return {};
+        }
+        m_object_ids.set(&object, m_next_object_id++);
+
+        if (is<JS::ArrayBuffer>(object)) {
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(object);
+
+            // NOTE: Buffers in the transfer list are detached after serialization, and only referenced by their holder here.
+            if (auto index = m_transfer_indices.get(&array_buffer); index.has_value()) {
+                m_serialized.append(ValueTag::TransferredArrayBuffer);
+                m_serialized.append(*index);
+                return {};
+            }
+
+            // If IsDetachedBuffer(value) is true, then throw a "DataCloneError" DOMException.
+            if (array_buffer.is_detached())
+                return error("Cannot serialize detached ArrayBuffer"sv);
+
+            auto bytes = array_buffer.buffer().bytes();
+            m_serialized.append(ValueTag::ArrayBuffer);
+            m_serialized.append(bytes.size());
+            for (size_t i = 0; i < bytes.size(); i += 4) {
+                u32 packed = 0;
+                bytes.slice(i, min<size_t>(4, bytes.size() - i)).copy_to({ &packed, sizeof(packed) });
+                m_serialized.append(packed);
+            }
+            return {};
+        }
+
+        if (object.is_function() || is<Bindings::PlatformObject>(object))
+            return error("Cannot serialize platform objects or functions"sv);
+
+        if (is<JS::Array>(object)) {
+            m_serialized.append(ValueTag::Array);
+            m_serialized.append(TRY(JS::length_of_array_like(m_vm, object)));
+        } else if (object.class_name() == "Object"sv) {
+            m_serialized.append(ValueTag::Object);
+        } else {
+            // TODO: Define many more types
+            return error("Unsupported type"sv);
+        }
+
+        // For each key in ! EnumerableOwnPropertyNames(value, key):
+        auto keys = TRY(object.enumerable_own_property_names(JS::Object::PropertyKind::Key));
+        m_serialized.append(keys.size());
+        for (auto& key : keys) {
+            // 1. If ! HasOwnProperty(value, key) is true, then:
+            //     1. Let inputValue be ? value.[[Get]](key, value).
+            //     2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
+            //     3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
+            // NOTE: We write the value even if a getter deleted the property, so that the property count stays correct.
+            auto property_key = TRY(JS::PropertyKey::from_value(m_vm, key));
+            auto value = TRY(object.get(property_key));
+            TRY(serialize_string(key.as_string()));
+            TRY(serialize(value));
+        }
+        return {};
+    }
+
+    JS::NonnullGCPtr<WebIDL::DOMException> error(StringView message)
+    {
+        return WebIDL::DataCloneError::create(*m_vm.current_realm(), message);
     }
 
-private:
-    AK::StringView m_error;
-    SerializationMemory m_memory; // JS value -> index
-    SerializationRecord m_serialized;
     JS::VM& m_vm;
+    HashMap<JS::Object const*, u32> m_object_ids; // JS object -> number
+    u32 m_next_object_id { 0 };
+    HashMap<JS::ArrayBuffer const*, u32> m_transfer_indices; // Transferred ArrayBuffer -> index into transfer data holders
+    SerializationRecord m_serialized;
 };
 
 class Deserializer {
 public:
-    Deserializer(JS::VM& vm, JS::Realm& target_realm, SerializationRecord const& v)
+    Deserializer(JS::VM& vm, JS::Realm& target_realm, SerializationRecord const& v, Vector<ByteBuffer>* transfer_data_holders = nullptr)
         : m_vm(vm)
+        , m_realm(target_realm)
         , m_vector(v)
-        , m_memory(target_realm.heap())
+        , m_objects(target_realm.heap())
+        , m_transfer_data_holders(transfer_data_holders)
     {
     }
 
-    void deserialize()
+    WebIDL::ExceptionOr<JS::Value> deserialize()
     {
-        // First pass: fill up the memory with new values
-        u32 position = 0;
-        while (position < m_vector.size()) {
-            switch (m_vector[position++]) {
-            case ValueTag::NumberPrimitive: {
-                u32 bits[2];
-                bits[0] = m_vector[position++];
-                bits[1] = m_vector[position++];
-                double value = *bit_cast<double*>(&bits);
-                m_memory.append(JS::Value(value));
-                break;
-            }
-            default:
-                m_error = "Unsupported type"sv;
-                return;
+        auto value = TRY(deserialize_value());
+        if (m_position != m_vector.size())
+            return error("Trailing data"sv);
+        return value;
+    }
+
+private:
+    WebIDL::ExceptionOr<u32> read()
+    {
+        if (m_position >= m_vector.size())
+            return error("Truncated data"sv);
+        return m_vector[m_position++];
+    }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string()
+    {
+        auto length = TRY(read());
+        Utf16Data code_units;
+        TRY_OR_THROW_OOM(m_vm, code_units.try_ensure_capacity(length));
+        for (u32 i = 0; i < length; i += 2) {
+            auto packed = TRY(read());
+            code_units.unchecked_append(packed & 0xffff);
+            if (i + 1 < length)
+                code_units.unchecked_append(packed >> 16);
+        }
+        return JS::PrimitiveString::create(m_vm, TRY(JS::Utf16String::create(m_vm, move(code_units))));
+    }
+
+    WebIDL::ExceptionOr<JS::Value> deserialize_value()
+    {
+        switch (TRY(read())) {
+        case ValueTag::UndefinedPrimitive:
+            return JS::js_undefined();
+        case ValueTag::NullPrimitive:
+            return JS::js_null();
+        case ValueTag::BooleanPrimitive:
+            return JS::Value(TRY(read()) != 0);
+        case ValueTag::NumberPrimitive: {
+            u32 bits[2];
+            bits[0] = TRY(read());
+            bits[1] = TRY(read());
+            double value = *bit_cast<double*>(&bits);
+            return JS::Value(value);
+        }
+        case ValueTag::StringPrimitive:
+            return TRY(deserialize_string());
+        case ValueTag::ArrayBuffer: {
+            auto byte_length = TRY(read());
+            auto array_buffer = TRY(JS::ArrayBuffer::create(m_realm, byte_length));
+            m_objects.append(array_buffer);
+            auto bytes = array_buffer->buffer().bytes();
+            for (u32 i = 0; i < byte_length; i += 4) {
+                auto packed = TRY(read());
+                ReadonlyBytes { &packed, sizeof(packed) }.slice(0, min<size_t>(4, byte_length - i)).copy_to(bytes.slice(i));
             }
+            return array_buffer;
+        }
+        case ValueTag::TransferredArrayBuffer: {
+            auto index = TRY(read());
+            if (!m_transfer_data_holders || index >= m_transfer_data_holders->size())
+                return error("Invalid transfer data holder"sv);
+            // NOTE: This takes over the data block of the transferred ArrayBuffer without copying it.
+            auto array_buffer = JS::ArrayBuffer::create(m_realm, move(m_transfer_data_holders->at(index)));
+            m_objects.append(array_buffer);
+            return array_buffer;
         }
+        case ValueTag::Array: {
+            auto length = TRY(read());
+            auto array = TRY(JS::Array::create(m_realm, length));
+            m_objects.append(array);
+            TRY(deserialize_properties(array));
+            return array;
+        }
+        case ValueTag::Object: {
+            auto object = JS::Object::create(m_realm, m_realm.intrinsics().object_prototype());
+            m_objects.append(object);
+            TRY(deserialize_properties(object));
+            return object;
+        }
+        case ValueTag::ObjectReference: {
+            auto id = TRY(read());
+            if (id >= m_objects.size())
+                return error("Invalid object reference"sv);
+            return m_objects[id];
+        }
+        default:
+            return error("Unsupported type"sv);
+        }
+    }
 
-        // Second pass: Update the objects to point to other objects in memory
+    WebIDL::ExceptionOr<void> deserialize_properties(JS::Object& object)
+    {
+        // For each Record { [[Key]], [[Value]] } entry of serialized.[[Properties]]:
+        auto property_count = TRY(read());
+        for (u32 i = 0; i < property_count; ++i) {
+            // 1. Let deserializedValue be ? StructuredDeserialize(entry.[[Value]], targetRealm, memory).
+            // 2. Let result be ! CreateDataProperty(value, entry.[[Key]], deserializedValue).
+            auto key = TRY(deserialize_string());
+            auto value = TRY(deserialize_value());
+            auto property_key = MUST(JS::PropertyKey::from_value(m_vm, key));
+            MUST(object.create_data_property(property_key, value));
+        }
+        return {};
     }
 
-    WebIDL::ExceptionOr<JS::Value> result()
+    JS::NonnullGCPtr<WebIDL::DOMException> error(StringView message)
     {
-        if (m_error.is_null())
-            return m_memory[0];
-        return throw_completion(WebIDL::DataCloneError::create(*m_vm.current_realm(), m_error));
+        return WebIDL::DataCloneError::create(m_realm, message);
     }
 
-private:
     JS::VM& m_vm;
+    JS::Realm& m_realm;
     SerializationRecord const& m_vector;
-    JS::MarkedVector<JS::Value> m_memory; // Index -> JS value
-    StringView m_error;
+    size_t m_position { 0 };
+    JS::MarkedVector<JS::Value> m_objects; // Number -> JS object
+    Vector<ByteBuffer>* m_transfer_data_holders { nullptr };
 };
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserialize
@@ -141,8 +344,67 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& v
     (void)memory;
 
     Serializer serializer(vm);
-    serializer.serialize(value);
-    return serializer.result(); // TODO: Avoid several copies of vector
+    TRY(serializer.serialize(value));
+    return serializer.result();
+}
+
+// https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
+WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let memory be an empty map.
+    HashMap<JS::ArrayBuffer const*, u32> transfer_indices;
+
+    // 2. For each transferable of transferList:
+    for (auto const& transferable : transfer_list) {
+        // 1. If transferable has neither an [[ArrayBufferData]] internal slot nor a [[Detached]] internal slot, then throw a "DataCloneError" DOMException.
+        // FIXME: Support transferring platform objects, like MessagePort.
+        if (!is<JS::ArrayBuffer>(*transferable))
+            return WebIDL::DataCloneError::create(realm, "Cannot transfer type");
+
+        // 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+
+        // 3. If memory[transferable] exists, then throw a "DataCloneError" DOMException.
+        auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+        if (transfer_indices.contains(&array_buffer))
+            return WebIDL::DataCloneError::create(realm, "Cannot transfer value twice");
+
+        // 4. Set memory[transferable] to { [[Type]]: an uninitialized value }.
+        transfer_indices.set(&array_buffer, transfer_indices.size());
+    }
+
+    // 3. Let serialized be ? StructuredSerializeInternal(value, false, memory).
+    Serializer serializer(vm, transfer_indices);
+    TRY(serializer.serialize(value));
+
+    // 4. Let transferDataHolders be a new empty List.
+    Vector<ByteBuffer> transfer_data_holders;
+    TRY_OR_THROW_OOM(vm, transfer_data_holders.try_ensure_capacity(transfer_list.size()));
+
+    // 5. For each transferable of transferList:
+    for (auto const& transferable : transfer_list) {
+        auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+
+        // 1. If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (array_buffer.is_detached())
+            return WebIDL::DataCloneError::create(realm, "Cannot transfer detached ArrayBuffer");
+
+        // 2. If transferable has a [[Detached]] internal slot and transferable.[[Detached]] is true, then throw a "DataCloneError" DOMException.
+
+        // 3. Let dataHolder be memory[transferable].
+        // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
+        //     1. Set dataHolder.[[Type]] to "ArrayBuffer".
+        //     2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+        //     3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+        //     4. Perform ? DetachArrayBuffer(transferable).
+        // NOTE: Moving the data block out of the buffer leaves it detached, without copying the data.
+        transfer_data_holders.unchecked_append(move(array_buffer.buffer()));
+        TRY(JS::detach_array_buffer(vm, array_buffer));
+    }
+
+    // 6. Return { [[Serialized]]: serialized, [[TransferDataHolders]]: transferDataHolders }.
+    return SerializedTransferRecord { serializer.result(), move(transfer_data_holders) };
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserialize
@@ -152,8 +414,15 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationR
     (void)memory;
 
     Deserializer deserializer(vm, target_realm, serialized);
-    deserializer.deserialize();
-    return deserializer.result();
+    return deserializer.deserialize();
+}
+
+// https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserializewithtransfer
+WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer(JS::VM& vm, SerializedTransferRecord& serialize_with_transfer_result, JS::Realm& target_realm)
+{
+    // NOTE: Transferred ArrayBuffers are created lazily when the serialized data refers to them, taking over the data holder.
+    Deserializer deserializer(vm, target_realm, serialize_with_transfer_result.serialized, &serialize_with_transfer_result.transfer_data_holders);
+    return deserializer.deserialize();
 }
 
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Result.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -29,6 +30,14 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& v
 
 WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationRecord const& serialized, JS::Realm& target_realm, Optional<SerializationMemory>);
 
-// TODO: structured_[de]serialize_with_transfer
+// https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
+struct SerializedTransferRecord {
+    SerializationRecord serialized;
+    // NOTE: The only transferable type we support so far is ArrayBuffer, whose data holder is just its data block.
+    Vector<ByteBuffer> transfer_data_holders;
+};
+
+WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value, Vector<JS::Handle<JS::Object>> const& transfer_list);
+WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer(JS::VM& vm, SerializedTransferRecord&, JS::Realm& target_realm);
 
 }
@@ -7,15 +7,37 @@
 #include <AK/Debug.h>
 #include <AK/DeprecatedString.h>
 #include <LibJS/Runtime/ConsoleObject.h>
+#include <LibJS/Runtime/IteratorOperations.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/HTML/Worker.h>
 #include <LibWeb/HTML/WorkerDebugConsoleClient.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
 
+// NOTE: The transfer argument of postMessage() is a sequence<object>.
+static WebIDL::ExceptionOr<Vector<JS::Handle<JS::Object>>> transfer_list_from_value(JS::VM& vm, JS::Value transfer)
+{
+    Vector<JS::Handle<JS::Object>> transfer_list;
+    if (transfer.is_undefined())
+        return transfer_list;
+
+    if (!transfer.is_object())
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObject, transfer.to_string_without_side_effects());
+
+    auto values = TRY(JS::iterable_to_list(vm, transfer));
+    for (auto value : values) {
+        if (!value.is_object())
+            return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObject, value.to_string_without_side_effects());
+        transfer_list.append(JS::make_handle(value.as_object()));
+    }
+    return transfer_list;
+}
+
 // https://html.spec.whatwg.org/multipage/workers.html#dedicated-workers-and-the-worker-interface
 Worker::Worker(FlyString const& script_url, WorkerOptions const options, DOM::Document& document)
     : DOM::EventTarget(document.realm())
@@ -137,7 +159,7 @@ void Worker::run_a_worker(AK::URL& url, EnvironmentSettingsObject& outside_setti
     m_worker_scope->define_native_function(
         m_worker_scope->shape().realm(),
         "postMessage",
-        [this](auto& vm) {
+        [this](auto& vm) -> JS::ThrowCompletionOr<JS::Value> {
             // This is the implementation of the function that the spawned worked calls
 
             // https://html.spec.whatwg.org/multipage/workers.html#dom-dedicatedworkerglobalscope-postmessage
@@ -146,20 +168,30 @@ void Worker::run_a_worker(AK::URL& url, EnvironmentSettingsObject& outside_setti
             // postMessage(message, options) on the port, with the same arguments, and returned the same return value
 
             auto message = vm.argument(0);
-            // FIXME: `transfer` not support by post_message yet
+            auto transfer = TRY(Bindings::throw_dom_exception_if_needed(vm, [&] { return transfer_list_from_value(vm, vm.argument(1)); }));
 
             dbgln_if(WEB_WORKER_DEBUG, "WebWorker: Inner post_message");
 
+            // NOTE: The message is serialized in the worker's VM and deserialized into the Worker's realm, so that no JS value
+            //       is shared between the two VMs. Transferred ArrayBuffers move their data block along without copying it.
+            auto serialize_with_transfer_result = TRY(Bindings::throw_dom_exception_if_needed(vm, [&] { return structured_serialize_with_transfer(vm, message, transfer); }));
+
             // FIXME: This is a bit of a hack, in reality, we should m_outside_port->post_message and the onmessage event
             //        should bubble up to the Worker itself from there.
 
             auto& event_loop = get_vm_event_loop(m_document->realm().vm());
 
-            event_loop.task_queue().add(HTML::Task::create(HTML::Task::Source::PostedMessage, nullptr, [this, message] {
+            event_loop.task_queue().add(HTML::Task::create(HTML::Task::Source::PostedMessage, nullptr, [this, serialize_with_transfer_result = move(serialize_with_transfer_result)]() mutable {
+                auto deserialize_record = structured_deserialize_with_transfer(this->vm(), serialize_with_transfer_result, realm());
+                if (deserialize_record.is_exception()) {
+                    dispatch_event(*MessageEvent::create(realm(), HTML::EventNames::messageerror));
+                    return;
+                }
+
                 MessageEventInit event_init {};
-                event_init.data = message;
+                event_init.data = deserialize_record.release_value();
                 event_init.origin = "<origin>";
-                dispatch_event(*MessageEvent::create(*m_worker_realm, HTML::EventNames::message, event_init));
+                dispatch_event(*MessageEvent::create(realm(), HTML::EventNames::message, event_init));
             }));
 
             return JS::js_undefined();
@@ -317,7 +349,7 @@ WebIDL::ExceptionOr<void> Worker::terminate()
 }
 
 // https://html.spec.whatwg.org/multipage/workers.html#dom-worker-postmessage
-void Worker::post_message(JS::Value message, JS::Value)
+WebIDL::ExceptionOr<void> Worker::post_message(JS::Value message, JS::Value transfer)
 {
     dbgln_if(WEB_WORKER_DEBUG, "WebWorker: Post Message: {}", message.to_string_without_side_effects());
 
@@ -325,8 +357,10 @@ void Worker::post_message(JS::Value message, JS::Value)
     auto& target_port = m_outside_port;
 
     // 2. Let options be «[ "transfer" → transfer ]».
+    auto transfer_list = TRY(transfer_list_from_value(vm(), transfer));
+
     // 3. Run the message port post message steps providing this, targetPort, message and options.
-    target_port->post_message(message);
+    return target_port->post_message(message, transfer_list);
 }
 
 #undef __ENUMERATE
@@ -4,12 +4,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventDispatcher.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/NavigationTiming/PerformanceTiming.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+#include <LibWeb/UserTiming/PerformanceMark.h>
+#include <LibWeb/UserTiming/PerformanceMeasure.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::HighResolutionTime {
 
@@ -28,6 +33,8 @@ void Performance::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_window.ptr());
     visitor.visit(m_timing.ptr());
+    for (auto& entry : m_entry_buffer)
+        visitor.visit(entry);
 }
 
 JS::GCPtr<NavigationTiming::PerformanceTiming> Performance::timing()
@@ -42,4 +49,181 @@ double Performance::time_origin() const
     return static_cast<double>(m_timer.origin_time().to_milliseconds());
 }
 
+// https://w3c.github.io/user-timing/#dom-performance-mark
+WebIDL::ExceptionOr<JS::NonnullGCPtr<UserTiming::PerformanceMark>> Performance::mark(DeprecatedString const& mark_name, UserTiming::PerformanceMarkOptions const& mark_options)
+{
+    // 1. Run the PerformanceMark constructor and let entry be the newly created object.
+    auto entry = TRY(UserTiming::PerformanceMark::construct_impl(realm(), mark_name, mark_options));
+
+    // FIXME: 2. Queue entry.
+
+    // 3. Add entry to the performance entry buffer.
+    m_entry_buffer.append(entry);
+
+    // 4. Return entry.
+    return entry;
+}
+
+// https://w3c.github.io/user-timing/#dom-performance-clearmarks
+void Performance::clear_marks(DeprecatedString const& mark_name)
+{
+    // 1. If markName is omitted, remove all PerformanceMark objects from the performance entry buffer.
+    // 2. Otherwise, remove all PerformanceMark objects listed in the performance entry buffer whose name is markName.
+    m_entry_buffer.remove_all_matching([&](auto const& entry) {
+        return is<UserTiming::PerformanceMark>(*entry) && (mark_name.is_null() || entry->name() == mark_name);
+    });
+
+    // 3. Return undefined.
+}
+
+// https://w3c.github.io/user-timing/#dom-performance-measure
+WebIDL::ExceptionOr<JS::NonnullGCPtr<UserTiming::PerformanceMeasure>> Performance::measure(DeprecatedString const& measure_name, DeprecatedString const& start_mark, DeprecatedString const& end_mark)
+{
+    // NOTE: Steps 1 and 2 only apply to the PerformanceMeasureOptions overload, which we don't support yet.
+
+    // 3. Compute end time as follows:
+    double end_time = 0;
+    //    1. If endMark is given, let end time be the value returned by running the convert a mark to a timestamp algorithm passing in endMark.
+    if (!end_mark.is_null())
+        end_time = TRY(convert_a_mark_to_a_timestamp(end_mark));
+    //    4. Otherwise, let end time be the value that would be returned by the Performance object's now() method.
+    else
+        end_time = now();
+
+    // 4. Compute start time as follows:
+    double start_time = 0;
+    //    3. Otherwise, if startOrMeasureOptions is a DOMString, let start time be the value returned by running the convert a mark to a timestamp algorithm passing in startOrMeasureOptions.
+    if (!start_mark.is_null())
+        start_time = TRY(convert_a_mark_to_a_timestamp(start_mark));
+    //    4. Otherwise, let start time be 0.
+
+    // 5. Create a new PerformanceMeasure object (entry) with this's relevant realm.
+    // 6. Set entry's name attribute to measureName.
+    // 7. Set entry's entryType attribute to DOMString "measure".
+    // 8. Set entry's startTime attribute to start time.
+    // 9. Set entry's duration attribute to the duration from start time to end time. The resulting duration value MAY be negative.
+    // 10. Set entry's detail attribute to null.
+    auto entry = UserTiming::PerformanceMeasure::create(realm(), measure_name, start_time, end_time - start_time, JS::js_null());
+
+    // FIXME: 11. Queue entry.
+
+    // 12. Add entry to the performance entry buffer.
+    m_entry_buffer.append(entry);
+
+    // 13. Return entry.
+    return entry;
+}
+
+// https://w3c.github.io/user-timing/#dom-performance-clearmeasures
+void Performance::clear_measures(DeprecatedString const& measure_name)
+{
+    // 1. If measureName is omitted, remove all PerformanceMeasure objects in the performance entry buffer.
+    // 2. Otherwise remove all PerformanceMeasure objects listed in the performance entry buffer whose name is measureName.
+    m_entry_buffer.remove_all_matching([&](auto const& entry) {
+        return is<UserTiming::PerformanceMeasure>(*entry) && (measure_name.is_null() || entry->name() == measure_name);
+    });
+
+    // 3. Return undefined.
+}
+
+// https://w3c.github.io/user-timing/#convert-a-mark-to-a-timestamp
+WebIDL::ExceptionOr<double> Performance::convert_a_mark_to_a_timestamp(DeprecatedString const& mark)
+{
+    // 1. If mark is a DOMString and it has the same name as a read only attribute in the PerformanceTiming interface, let end time be the value returned by running the convert a name to a timestamp algorithm with name set to the value of mark.
+    if (UserTiming::is_performance_timing_attribute_name(mark)) {
+        // https://w3c.github.io/user-timing/#convert-a-name-to-a-timestamp
+        // 2. If name is navigationStart, return 0.
+        if (mark == "navigationStart"sv)
+            return 0.0;
+
+        // 3. Let startTime be the value of navigationStart in the PerformanceTiming interface.
+        // 4. Let endTime be the value of name in the PerformanceTiming interface.
+        // 5. If endTime is 0, throw an InvalidAccessError.
+        // NOTE: None of the PerformanceTiming attributes are implemented yet, they are all 0.
+        return WebIDL::InvalidAccessError::create(realm(), DeprecatedString::formatted("PerformanceTiming attribute '{}' has no value", mark));
+    }
+
+    // 2. Otherwise, if mark is a DOMString, let end time be the value of the startTime attribute from the most recent occurrence of a PerformanceMark object in the performance entry buffer whose name is mark.
+    //    If no matching entry is found, throw a SyntaxError.
+    for (auto const& entry : m_entry_buffer.in_reverse()) {
+        if (is<UserTiming::PerformanceMark>(*entry) && entry->name() == mark)
+            return entry->start_time();
+    }
+    return WebIDL::SyntaxError::create(realm(), DeprecatedString::formatted("No mark named '{}' exists", mark));
+}
+
+// https://w3c.github.io/performance-timeline/#dom-performance-getentries
+Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> Performance::get_entries()
+{
+    // Returns a PerformanceEntryList object returned by the filter buffer map by name and type algorithm with name and type set to null.
+    return filter_buffer_by_name_and_type({}, {});
+}
+
+// https://w3c.github.io/performance-timeline/#dom-performance-getentriesbytype
+Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> Performance::get_entries_by_type(DeprecatedString const& type)
+{
+    // Returns a PerformanceEntryList object returned by filter buffer map by name and type algorithm with name set to null, and type set to the method's input type parameter.
+    return filter_buffer_by_name_and_type({}, type);
+}
+
+// https://w3c.github.io/performance-timeline/#dom-performance-getentriesbyname
+Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> Performance::get_entries_by_name(DeprecatedString const& name, DeprecatedString const& type)
+{
+    // Returns a PerformanceEntryList object returned by filter buffer map by name and type algorithm with name set to the method input name parameter, and type set to null if optional entryType is omitted, or set to the method's input type parameter otherwise.
+    return filter_buffer_by_name_and_type(name, type);
+}
+
+// https://w3c.github.io/performance-timeline/#filter-buffer-map-by-name-and-type
+Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> Performance::filter_buffer_by_name_and_type(DeprecatedString const& name, DeprecatedString const& type)
+{
+    queue_long_task_entries();
+
+    // 1. Let result be an initially empty list.
+    Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> result;
+
+    // 2. Let map be the performance entry buffer map associated with the relevant global object of this.
+    // 3. Let tuple list be an empty list.
+    // 4. If type is not null, append the result of getting the value of entry on map given type as key to tuple list. Otherwise, assign the result of get the values on map to tuple list.
+    // 5. For each tuple in tuple list, run the following steps:
+    //    1. Let buffer be tuple's performance entry buffer.
+    //    2. If tuple's availableFromTimeline is false, continue to the next tuple.
+    //    3. Let entries be the result of running filter buffer by name and type with buffer, name and type as inputs.
+    //    4. For each entry in entries, append entry to result.
+    // NOTE: We keep a single buffer for all entry types.
+    for (auto const& entry : m_entry_buffer) {
+        if (!type.is_null() && entry->entry_type() != type)
+            continue;
+        if (!name.is_null() && entry->name() != name)
+            continue;
+        result.append(JS::make_handle(*entry));
+    }
+
+    // 6. Sort results's entries in chronological order with respect to startTime
+    quick_sort(result, [](auto const& a, auto const& b) { return a->start_time() < b->start_time(); });
+
+    // 7. Return result.
+    return result;
+}
+
+// https://w3c.github.io/longtasks/#report-long-tasks
+void Performance::queue_long_task_entries()
+{
+    // NOTE: Long task entries aren't supposed to be available from the timeline, only through a PerformanceObserver.
+    //       Since we don't have PerformanceObserver yet, we expose them through the entry buffer for now.
+    //       They also lack attribution, and are plain PerformanceEntry objects instead of PerformanceLongTaskTiming ones.
+    if (!m_window->has_associated_document())
+        return;
+
+    auto const& long_tasks = m_window->associated_document().performance_recorder().long_tasks();
+    for (auto const& long_task : long_tasks) {
+        if (long_task.start <= m_last_queued_long_task_start)
+            continue;
+        m_last_queued_long_task_start = long_task.start;
+
+        auto start_time = static_cast<double>((long_task.start - m_timer.origin_time()).to_microseconds()) / 1000.0;
+        auto duration = static_cast<double>(long_task.duration.to_microseconds()) / 1000.0;
+        m_entry_buffer.append(PerformanceTimeline::PerformanceEntry::create(realm(), "self", "longtask", start_time, duration));
+    }
+}
+
 }
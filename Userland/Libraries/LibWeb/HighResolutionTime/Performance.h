@@ -8,6 +8,7 @@
 
 #include <LibCore/ElapsedTimer.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HighResolutionTime {
 
@@ -22,14 +23,33 @@ public:
 
     JS::GCPtr<NavigationTiming::PerformanceTiming> timing();
 
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<UserTiming::PerformanceMark>> mark(DeprecatedString const& mark_name, UserTiming::PerformanceMarkOptions const& mark_options);
+    void clear_marks(DeprecatedString const& mark_name);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<UserTiming::PerformanceMeasure>> measure(DeprecatedString const& measure_name, DeprecatedString const& start_mark, DeprecatedString const& end_mark);
+    void clear_measures(DeprecatedString const& measure_name);
+
+    Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> get_entries();
+    Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> get_entries_by_type(DeprecatedString const& type);
+    Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> get_entries_by_name(DeprecatedString const& name, DeprecatedString const& type);
+
 private:
     explicit Performance(HTML::Window&);
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    WebIDL::ExceptionOr<double> convert_a_mark_to_a_timestamp(DeprecatedString const& mark);
+    Vector<JS::Handle<PerformanceTimeline::PerformanceEntry>> filter_buffer_by_name_and_type(DeprecatedString const& name, DeprecatedString const& type);
+    void queue_long_task_entries();
+
     JS::NonnullGCPtr<HTML::Window> m_window;
     JS::GCPtr<NavigationTiming::PerformanceTiming> m_timing;
 
+    // https://w3c.github.io/performance-timeline/#dfn-performance-entry-buffer
+    Vector<JS::NonnullGCPtr<PerformanceTimeline::PerformanceEntry>> m_entry_buffer;
+
+    // NOTE: Long tasks are measured by the associated document's PerformanceRecorder, and turned into entries lazily.
+    Time m_last_queued_long_task_start;
+
     Core::ElapsedTimer m_timer;
 };
 
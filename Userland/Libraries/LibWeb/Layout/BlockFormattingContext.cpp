@@ -370,6 +370,9 @@ static bool margins_collapse_through(Box const& box, LayoutState& state)
 
 CSSPixels BlockFormattingContext::compute_auto_height_for_block_level_element(Box const& box, AvailableSpace const& available_space)
 {
+    if (auto skipped_contents_height = box.skipped_contents_height(); skipped_contents_height.has_value())
+        return *skipped_contents_height;
+
     if (creates_block_formatting_context(box)) {
         return compute_auto_height_for_block_formatting_context_root(verify_cast<BlockContainer>(box));
     }
@@ -28,7 +28,7 @@ public:
     bool is_body() const;
 
     virtual Optional<CSSPixels> intrinsic_width() const { return {}; }
-    virtual Optional<CSSPixels> intrinsic_height() const { return {}; }
+    virtual Optional<CSSPixels> intrinsic_height() const { return m_skipped_contents_height; }
     virtual Optional<float> intrinsic_aspect_ratio() const { return {}; }
 
     bool has_intrinsic_width() const { return intrinsic_width().has_value(); }
@@ -39,6 +39,11 @@ public:
 
     virtual void did_set_rect() { }
 
+    // NOTE: This is set when the box's element skips its contents (see content-visibility). The box has no children
+    //       in the layout tree then, and is sized as if it were empty but with this as its intrinsic height.
+    Optional<CSSPixels> skipped_contents_height() const { return m_skipped_contents_height; }
+    void set_skipped_contents_height(Optional<CSSPixels> height) { m_skipped_contents_height = height; }
+
     virtual RefPtr<Painting::Paintable> create_paintable() const override;
 
 protected:
@@ -47,6 +52,8 @@ protected:
 
 private:
     virtual bool is_box() const final { return true; }
+
+    Optional<CSSPixels> m_skipped_contents_height;
 };
 
 template<>
@@ -1741,6 +1741,10 @@ void GridFormattingContext::run(Box const& box, LayoutMode, AvailableSpace const
             independent_formatting_context->parent_context_did_dimension_child_root_box();
     };
 
+    // FIXME: Once the grid areas are known, each grid item establishes an independent formatting context that doesn't
+    //        depend on its siblings, so these could be laid out in parallel. That needs the intrinsic size cache in
+    //        LayoutState, and the ref-counted fonts and style values used during layout, to be safe to share between
+    //        threads first.
     for (auto& positioned_box : m_positioned_boxes) {
         auto resolved_row_start = box.computed_values().row_gap().is_auto() ? positioned_box.row : positioned_box.row * 2;
         auto resolved_row_span = box.computed_values().row_gap().is_auto() ? positioned_box.row_span : positioned_box.row_span * 2;
@@ -48,6 +48,8 @@ void InitialContainingBlock::build_stacking_context_tree()
 
 void InitialContainingBlock::paint_all_phases(PaintContext& context)
 {
+    PerformanceRecorder::Scope performance_scope(&document().performance_recorder(), PerformancePhase::Paint);
+
     build_stacking_context_tree_if_needed();
     context.painter().fill_rect(context.enclosing_device_rect(paint_box()->absolute_rect()).to_type<int>(), document().background_color(context.palette()));
     context.painter().translate(-context.device_viewport_rect().location().to_type<int>());
@@ -127,13 +127,9 @@ LabelableNode* Label::labeled_control()
     // whose ID is equal to the value of the for attribute, and the first such element in tree order is
     // a labelable element, then that element is the label element's labeled control.
     if (auto for_ = dom_node().for_(); !for_.is_null()) {
-        document().layout_node()->for_each_in_inclusive_subtree_of_type<LabelableNode>([&](auto& node) {
-            if (node.dom_node().attribute(HTML::AttributeNames::id) == for_) {
-                control = &node;
-                return IterationDecision::Break;
-            }
-            return IterationDecision::Continue;
-        });
+        auto element = document().get_element_by_id(for_);
+        if (element && is<LabelableNode>(element->layout_node()))
+            control = static_cast<LabelableNode*>(element->layout_node());
         return control;
     }
 
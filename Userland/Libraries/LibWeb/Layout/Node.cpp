@@ -367,6 +367,10 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
     if (auto box_sizing = computed_style.box_sizing(); box_sizing.has_value())
         computed_values.set_box_sizing(box_sizing.release_value());
 
+    if (auto content_visibility = computed_style.content_visibility(); content_visibility.has_value())
+        computed_values.set_content_visibility(content_visibility.release_value());
+    computed_values.set_contain_intrinsic_height(computed_style.size_value(CSS::PropertyID::ContainIntrinsicHeight));
+
     if (auto maybe_font_variant = computed_style.font_variant(); maybe_font_variant.has_value())
         computed_values.set_font_variant(maybe_font_variant.release_value());
 
@@ -16,6 +16,7 @@
 #include <LibWeb/Dump.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/HTMLProgressElement.h>
+#include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/InitialContainingBlock.h>
 #include <LibWeb/Layout/ListItemBox.h>
 #include <LibWeb/Layout/ListItemMarkerBox.h>
@@ -238,9 +239,31 @@ ErrorOr<void> TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::
         insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
     }
 
+    // NOTE: An element that skips its contents doesn't get layout nodes for them, not even for its ::before and ::after
+    //       pseudo-elements. This way, off-screen parts of long pages don't have to be laid out until they're close
+    //       to being scrolled into view.
+    bool skips_contents = false;
+    if (is<DOM::Element>(dom_node) && is<Layout::Box>(*layout_node) && !layout_node->is_replaced_box()) {
+        auto& element = static_cast<DOM::Element&>(dom_node);
+        if (element.skips_its_contents()) {
+            skips_contents = true;
+            auto& box = static_cast<Layout::Box&>(*layout_node);
+            // NOTE: Once an element with content-visibility: auto has been laid out, we use its last remembered size
+            //       as if contain-intrinsic-height were `auto <length>`, so that skipping its contents doesn't move
+            //       everything after it around.
+            auto const& contain_intrinsic_height = box.computed_values().contain_intrinsic_height();
+            if (box.computed_values().content_visibility() == CSS::ContentVisibility::Auto && element.last_remembered_height().has_value())
+                box.set_skipped_contents_height(element.last_remembered_height());
+            else if (contain_intrinsic_height.is_length())
+                box.set_skipped_contents_height(contain_intrinsic_height.length().to_px(box));
+            else
+                box.set_skipped_contents_height(0);
+        }
+    }
+
     auto* shadow_root = is<DOM::Element>(dom_node) ? verify_cast<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children()) {
+    if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !skips_contents) {
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
         if (shadow_root)
             TRY(create_layout_tree(*shadow_root, context));
@@ -252,7 +275,7 @@ ErrorOr<void> TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::
     }
 
     // Add nodes for the ::before and ::after pseudo-elements.
-    if (is<DOM::Element>(dom_node)) {
+    if (is<DOM::Element>(dom_node) && !skips_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
         TRY(create_pseudo_element_if_needed(element, CSS::Selector::PseudoElement::Before, AppendOrPrepend::Prepend));
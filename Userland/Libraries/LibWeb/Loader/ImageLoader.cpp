@@ -138,21 +138,21 @@ bool ImageLoader::has_image() const
 {
     if (!resource())
         return false;
-    return bitmap(0);
+    return !resource()->natural_size().is_empty();
 }
 
 unsigned ImageLoader::width() const
 {
     if (!resource())
         return 0;
-    return bitmap(0) ? bitmap(0)->width() : 0;
+    return resource()->natural_size().width();
 }
 
 unsigned ImageLoader::height() const
 {
     if (!resource())
         return 0;
-    return bitmap(0) ? bitmap(0)->height() : 0;
+    return resource()->natural_size().height();
 }
 
 Gfx::Bitmap const* ImageLoader::bitmap(size_t frame_index) const
@@ -162,4 +162,11 @@ Gfx::Bitmap const* ImageLoader::bitmap(size_t frame_index) const
     return resource()->bitmap(frame_index);
 }
 
+Gfx::Bitmap const* ImageLoader::bitmap_for_size(size_t frame_index, Gfx::IntSize size) const
+{
+    if (!resource())
+        return nullptr;
+    return resource()->bitmap_for_size(frame_index, size);
+}
+
 }
@@ -11,6 +11,18 @@
 
 namespace Web {
 
+// NOTE: Decoded images can easily take up far more memory than their encoded data, so we keep the total size of
+//       decoded bitmaps in this process below a budget, by discarding the least recently used images that aren't
+//       visible in the viewport. They are decoded again the next time someone asks for them.
+static constexpr size_t decoded_image_data_budget = 256 * MiB;
+static size_t s_total_decoded_size = 0;
+
+ImageResource::DecodedList& ImageResource::decoded_list()
+{
+    static DecodedList list;
+    return list;
+}
+
 NonnullRefPtr<ImageResource> ImageResource::convert_from_resource(Resource& resource)
 {
     return adopt_ref(*new ImageResource(resource));
@@ -26,11 +38,14 @@ ImageResource::ImageResource(Resource& resource)
 {
 }
 
-ImageResource::~ImageResource() = default;
+ImageResource::~ImageResource()
+{
+    did_change_decoded_size(0);
+}
 
 int ImageResource::frame_duration(size_t frame_index) const
 {
-    decode_if_needed();
+    decode_metadata_if_needed();
     if (frame_index >= m_decoded_frames.size())
         return 0;
     return m_decoded_frames[frame_index].duration;
@@ -44,25 +59,43 @@ void ImageResource::decode_if_needed() const
     if (m_has_attempted_decode)
         return;
 
-    if (!m_decoded_frames.is_empty())
-        return;
-
     auto image = Platform::ImageCodecPlugin::the().decode_image(encoded_data());
     m_has_attempted_decode = true;
+    m_has_metadata = true;
 
     if (!image.has_value()) {
         dbgln("Could not decode image resource {}", url());
+        m_decoded_frames.clear();
+        m_natural_size = {};
         return;
     }
 
     m_loop_count = image.value().loop_count;
     m_animated = image.value().is_animated;
     m_decoded_frames.resize(image.value().frames.size());
+    size_t decoded_size = 0;
     for (size_t i = 0; i < m_decoded_frames.size(); ++i) {
         auto& frame = m_decoded_frames[i];
         frame.bitmap = image.value().frames[i].bitmap;
         frame.duration = image.value().frames[i].duration;
+        frame.mipmaps.clear();
+        if (frame.bitmap)
+            decoded_size += frame.bitmap->size_in_bytes();
     }
+    m_natural_size = !m_decoded_frames.is_empty() && m_decoded_frames[0].bitmap ? m_decoded_frames[0].bitmap->size() : Gfx::IntSize {};
+
+    did_change_decoded_size(decoded_size);
+    did_use_decoded_data();
+    enforce_decoded_data_budget(*this);
+}
+
+void ImageResource::decode_metadata_if_needed() const
+{
+    // NOTE: The frame count, durations and natural size survive discarding the decoded bitmaps, so we only have to
+    //       decode if we've never done so before.
+    if (m_has_metadata)
+        return;
+    decode_if_needed();
 }
 
 Gfx::Bitmap const* ImageResource::bitmap(size_t frame_index) const
@@ -70,18 +103,138 @@ Gfx::Bitmap const* ImageResource::bitmap(size_t frame_index) const
     decode_if_needed();
     if (frame_index >= m_decoded_frames.size())
         return nullptr;
+    did_use_decoded_data();
     return m_decoded_frames[frame_index].bitmap;
 }
 
-void ImageResource::update_volatility()
+// Box-filters the bitmap down to half its size (rounding up), weighting each color by its alpha so that transparent
+// pixels don't bleed their color into the result.
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> downscale_by_half(Gfx::Bitmap const& source)
+{
+    auto new_size = Gfx::IntSize { (source.width() + 1) / 2, (source.height() + 1) / 2 };
+    auto result = TRY(Gfx::Bitmap::try_create(Gfx::BitmapFormat::BGRA8888, new_size));
+
+    for (int y = 0; y < new_size.height(); ++y) {
+        for (int x = 0; x < new_size.width(); ++x) {
+            u32 red = 0, green = 0, blue = 0, alpha = 0, samples = 0;
+            for (int sy = y * 2; sy < min(y * 2 + 2, source.height()); ++sy) {
+                for (int sx = x * 2; sx < min(x * 2 + 2, source.width()); ++sx) {
+                    auto color = source.get_pixel(sx, sy);
+                    red += color.red() * color.alpha();
+                    green += color.green() * color.alpha();
+                    blue += color.blue() * color.alpha();
+                    alpha += color.alpha();
+                    ++samples;
+                }
+            }
+            if (alpha == 0) {
+                result->set_pixel(x, y, Gfx::Color::Transparent);
+                continue;
+            }
+            result->set_pixel(x, y, Gfx::Color(red / alpha, green / alpha, blue / alpha, alpha / samples));
+        }
+    }
+    return result;
+}
+
+Gfx::Bitmap const* ImageResource::bitmap_for_size(size_t frame_index, Gfx::IntSize size) const
+{
+    decode_if_needed();
+    if (frame_index >= m_decoded_frames.size())
+        return nullptr;
+    did_use_decoded_data();
+
+    auto& frame = m_decoded_frames[frame_index];
+    if (!frame.bitmap)
+        return nullptr;
+
+    // Find the smallest level that is still at least as large as the requested size in both dimensions, building any
+    // missing levels on the way there.
+    Gfx::Bitmap const* best = frame.bitmap;
+    for (size_t level = 0;; ++level) {
+        auto next_size = Gfx::IntSize { (best->width() + 1) / 2, (best->height() + 1) / 2 };
+        if (next_size.width() < size.width() || next_size.height() < size.height() || next_size == best->size())
+            break;
+
+        if (level == frame.mipmaps.size()) {
+            auto mipmap = downscale_by_half(*best);
+            if (mipmap.is_error())
+                break;
+            frame.mipmaps.append(mipmap.release_value());
+            did_change_decoded_size(m_decoded_size + frame.mipmaps.last()->size_in_bytes());
+            enforce_decoded_data_budget(*this);
+        }
+        best = frame.mipmaps[level];
+    }
+    return best;
+}
+
+bool ImageResource::is_visible_in_viewport() const
 {
     bool visible_in_viewport = false;
-    for_each_client([&](auto& client) {
-        if (static_cast<const ImageResourceClient&>(client).is_visible_in_viewport())
+    const_cast<ImageResource&>(*this).for_each_client([&](auto& client) {
+        if (static_cast<ImageResourceClient const&>(client).is_visible_in_viewport())
             visible_in_viewport = true;
     });
+    return visible_in_viewport;
+}
+
+void ImageResource::did_use_decoded_data() const
+{
+    if (m_decoded_size == 0)
+        return;
+
+    // Keep the list ordered from least to most recently used.
+    if (m_decoded_list_node.is_in_list())
+        m_decoded_list_node.remove();
+    decoded_list().append(const_cast<ImageResource&>(*this));
+}
+
+void ImageResource::did_change_decoded_size(size_t new_size) const
+{
+    s_total_decoded_size -= m_decoded_size;
+    s_total_decoded_size += new_size;
+    m_decoded_size = new_size;
+
+    if (m_decoded_size == 0 && m_decoded_list_node.is_in_list())
+        m_decoded_list_node.remove();
+}
+
+void ImageResource::discard_decoded_data() const
+{
+    // NOTE: We keep the frames themselves around, since their durations (and the frame count) are still needed to
+    //       animate the image while it's off-screen.
+    for (auto& frame : m_decoded_frames) {
+        frame.bitmap = nullptr;
+        frame.mipmaps.clear();
+    }
+    m_has_attempted_decode = false;
+    did_change_decoded_size(0);
+}
+
+void ImageResource::enforce_decoded_data_budget(ImageResource const& resource_in_use)
+{
+    if (s_total_decoded_size <= decoded_image_data_budget)
+        return;
 
-    if (!visible_in_viewport) {
+    Vector<NonnullRefPtr<ImageResource>> resources_to_discard;
+    size_t total_size_after_discarding = s_total_decoded_size;
+    for (auto& resource : decoded_list()) {
+        if (total_size_after_discarding <= decoded_image_data_budget)
+            break;
+        if (&resource == &resource_in_use || resource.is_visible_in_viewport())
+            continue;
+        total_size_after_discarding -= resource.m_decoded_size;
+        resources_to_discard.append(resource);
+    }
+
+    for (auto& resource : resources_to_discard)
+        resource->discard_decoded_data();
+}
+
+void ImageResource::update_volatility()
+{
+    if (!is_visible_in_viewport()) {
         for (auto& frame : m_decoded_frames) {
             if (frame.bitmap)
                 frame.bitmap->set_volatile();
@@ -103,8 +256,7 @@ void ImageResource::update_volatility()
     if (still_has_decoded_image)
         return;
 
-    m_decoded_frames.clear();
-    m_has_attempted_decode = false;
+    discard_decoded_data();
 }
 
 ImageResourceClient::~ImageResourceClient() = default;
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/IntrusiveList.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/Loader/Resource.h>
 
 namespace Web {
@@ -21,26 +23,42 @@ public:
     struct Frame {
         RefPtr<Gfx::Bitmap> bitmap;
         size_t duration { 0 };
+
+        // Pre-scaled copies of the bitmap, each half the size of the previous one. Built lazily when the image is
+        // painted at a much smaller size than its natural size.
+        Vector<NonnullRefPtr<Gfx::Bitmap>> mipmaps;
     };
 
     Gfx::Bitmap const* bitmap(size_t frame_index = 0) const;
+
+    // Returns the smallest available version of the frame that is still at least as large as the given size, so that
+    // painting a large image at a small size doesn't have to sample the full-size bitmap every time.
+    Gfx::Bitmap const* bitmap_for_size(size_t frame_index, Gfx::IntSize) const;
+
     int frame_duration(size_t frame_index) const;
     size_t frame_count() const
     {
-        decode_if_needed();
+        decode_metadata_if_needed();
         return m_decoded_frames.size();
     }
     bool is_animated() const
     {
-        decode_if_needed();
+        decode_metadata_if_needed();
         return m_animated;
     }
     size_t loop_count() const
     {
-        decode_if_needed();
+        decode_metadata_if_needed();
         return m_loop_count;
     }
 
+    // NOTE: This stays known after the decoded bitmaps have been discarded, so layout doesn't force a re-decode.
+    Gfx::IntSize natural_size() const
+    {
+        decode_metadata_if_needed();
+        return m_natural_size;
+    }
+
     void update_volatility();
 
 private:
@@ -48,11 +66,26 @@ private:
     explicit ImageResource(Resource&);
 
     void decode_if_needed() const;
+    void decode_metadata_if_needed() const;
+
+    bool is_visible_in_viewport() const;
+    void did_use_decoded_data() const;
+    void did_change_decoded_size(size_t new_size) const;
+    void discard_decoded_data() const;
+    static void enforce_decoded_data_budget(ImageResource const& resource_in_use);
 
     mutable bool m_animated { false };
     mutable int m_loop_count { 0 };
+    mutable Gfx::IntSize m_natural_size;
     mutable Vector<Frame> m_decoded_frames;
     mutable bool m_has_attempted_decode { false };
+    mutable bool m_has_metadata { false };
+
+    mutable size_t m_decoded_size { 0 };
+    mutable IntrusiveListNode<ImageResource> m_decoded_list_node;
+
+    using DecodedList = IntrusiveList<&ImageResource::m_decoded_list_node>;
+    static DecodedList& decoded_list();
 };
 
 class ImageResourceClient : public ResourceClient {
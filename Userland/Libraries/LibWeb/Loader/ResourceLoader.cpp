@@ -12,6 +12,7 @@
 #include <LibCore/File.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/LoadRequest.h>
 #include <LibWeb/Loader/ProxyMappings.h>
@@ -30,6 +31,17 @@ ResourceLoaderConnectorRequest::ResourceLoaderConnectorRequest() = default;
 
 ResourceLoaderConnectorRequest::~ResourceLoaderConnectorRequest() = default;
 
+void ResourceLoaderConnectorRequest::set_unbuffered_request_callbacks(HeadersReceived on_headers_received, DataReceived on_data_received, RequestFinished on_finish)
+{
+    on_buffered_request_finish = [on_headers_received = move(on_headers_received), on_data_received = move(on_data_received), on_finish = move(on_finish)](bool success, u32 total_size, auto const& response_headers, auto response_code, ReadonlyBytes payload) {
+        on_headers_received(response_headers, response_code);
+        if (!payload.is_empty())
+            on_data_received(payload);
+        on_finish(success, total_size);
+    };
+    set_should_buffer_all_input(true);
+}
+
 ResourceLoaderConnector::ResourceLoaderConnector() = default;
 
 ResourceLoaderConnector::~ResourceLoaderConnector() = default;
@@ -166,14 +178,25 @@ void ResourceLoader::load(LoadRequest& request, Function<void(ReadonlyBytes, Has
     emit_signpost(DeprecatedString::formatted("Starting load: {}", url_for_logging), id);
     dbgln("ResourceLoader: Starting load of: \"{}\"", url_for_logging);
 
-    auto const log_success = [url_for_logging, id](auto const& request) {
+    // NOTE: Loads are accounted to the page's active document at the time they finish, as there is nothing keeping the
+    //       requesting document around until then.
+    auto const record_load_time = [page = request.page().has_value() ? request.page()->make_weak_ptr() : WeakPtr<Page> {}, load_start_time = Time::now_monotonic()](auto const& request) {
+        if (!page)
+            return;
+        if (auto* document = page->top_level_browsing_context().active_document())
+            document->performance_recorder().record(PerformancePhase::ResourceLoading, load_start_time, request.load_time());
+    };
+
+    auto const log_success = [url_for_logging, id, record_load_time](auto const& request) {
         auto load_time_ms = request.load_time().to_milliseconds();
+        record_load_time(request);
         emit_signpost(DeprecatedString::formatted("Finished load: {}", url_for_logging), id);
         dbgln("ResourceLoader: Finished load of: \"{}\", Duration: {}ms", url_for_logging, load_time_ms);
     };
 
-    auto const log_failure = [url_for_logging, id](auto const& request, auto const error_message) {
+    auto const log_failure = [url_for_logging, id, record_load_time](auto const& request, auto const error_message) {
         auto load_time_ms = request.load_time().to_milliseconds();
+        record_load_time(request);
         emit_signpost(DeprecatedString::formatted("Failed load: {}", url_for_logging), id);
         dbgln("ResourceLoader: Failed load of: \"{}\", \033[31;1mError: {}\033[0m, Duration: {}ms", url_for_logging, error_message, load_time_ms);
     };
@@ -363,6 +386,130 @@ void ResourceLoader::load(const AK::URL& url, Function<void(ReadonlyBytes, HashM
     load(request, move(success_callback), move(error_callback), timeout, move(timeout_callback));
 }
 
+RefPtr<ResourceLoaderConnectorRequest> ResourceLoader::load_unbuffered(LoadRequest& request, OnHeadersReceived on_headers_received, OnDataReceived on_data_received, OnComplete on_complete)
+{
+    auto& url = request.url();
+
+    // NOTE: Only network loads are worth streaming, everything else is produced in one go anyway.
+    if (url.scheme() != "http" && url.scheme() != "https" && url.scheme() != "gemini") {
+        struct Callbacks : public RefCounted<Callbacks> {
+            OnHeadersReceived on_headers_received;
+            OnDataReceived on_data_received;
+            OnComplete on_complete;
+        };
+        auto callbacks = adopt_ref(*new Callbacks);
+        callbacks->on_headers_received = move(on_headers_received);
+        callbacks->on_data_received = move(on_data_received);
+        callbacks->on_complete = move(on_complete);
+
+        load(
+            request,
+            [callbacks](auto data, auto& response_headers, auto status_code) {
+                callbacks->on_headers_received(response_headers, status_code);
+                if (!data.is_empty())
+                    callbacks->on_data_received(data);
+                callbacks->on_complete(true, {});
+            },
+            [callbacks](auto& error, auto) {
+                callbacks->on_complete(false, error.view());
+            });
+        return nullptr;
+    }
+
+    request.start_timer();
+
+    auto id = resource_id++;
+    auto url_for_logging = sanitized_url_for_logging(url);
+    emit_signpost(DeprecatedString::formatted("Starting load: {}", url_for_logging), id);
+    dbgln("ResourceLoader: Starting unbuffered load of: \"{}\"", url_for_logging);
+
+    auto const record_load_time = [page = request.page().has_value() ? request.page()->make_weak_ptr() : WeakPtr<Page> {}, load_start_time = Time::now_monotonic()](auto const& request) {
+        if (!page)
+            return;
+        if (auto* document = page->top_level_browsing_context().active_document())
+            document->performance_recorder().record(PerformancePhase::ResourceLoading, load_start_time, request.load_time());
+    };
+
+    auto const log_failure = [url_for_logging, id, record_load_time](auto const& request, auto const error_message) {
+        record_load_time(request);
+        emit_signpost(DeprecatedString::formatted("Failed load: {}", url_for_logging), id);
+        dbgln("ResourceLoader: Failed load of: \"{}\", \033[31;1mError: {}\033[0m, Duration: {}ms", url_for_logging, error_message, request.load_time().to_milliseconds());
+    };
+
+    if (is_port_blocked(url.port_or_default())) {
+        auto port_blocked_message = DeprecatedString::formatted("The port #{} is blocked", url.port_or_default());
+        log_failure(request, port_blocked_message);
+        on_complete(false, port_blocked_message.view());
+        return nullptr;
+    }
+
+    if (ContentFilter::the().is_filtered(url)) {
+        auto filter_message = "URL was filtered"sv;
+        log_failure(request, filter_message);
+        on_complete(false, filter_message);
+        return nullptr;
+    }
+
+    auto proxy = ProxyMappings::the().proxy_for_url(url);
+
+    HashMap<DeprecatedString, DeprecatedString> headers;
+    headers.set("User-Agent", m_user_agent);
+    headers.set("Accept-Encoding", "gzip, deflate, br");
+
+    for (auto& it : request.headers())
+        headers.set(it.key, it.value);
+
+    auto protocol_request = m_connector->start_request(request.method(), url, headers, request.body(), proxy);
+    if (!protocol_request) {
+        auto start_request_failure_msg = "Failed to initiate load"sv;
+        log_failure(request, start_request_failure_msg);
+        on_complete(false, start_request_failure_msg);
+        return nullptr;
+    }
+
+    m_active_requests.set(*protocol_request);
+
+    auto protocol_headers_received = [request, on_headers_received = move(on_headers_received)](auto const& response_headers, auto status_code) mutable {
+        if (request.page().has_value()) {
+            if (auto set_cookie = response_headers.get("Set-Cookie"); set_cookie.has_value())
+                store_response_cookies(request.page().value(), request.url(), *set_cookie);
+        }
+        on_headers_received(response_headers, status_code);
+    };
+
+    auto protocol_complete = [this, on_complete = move(on_complete), request, url_for_logging, id, record_load_time, log_failure, &protocol_request = *protocol_request](bool success, auto) mutable {
+        --m_pending_loads;
+        if (on_load_counter_change)
+            on_load_counter_change();
+
+        if (success) {
+            record_load_time(request);
+            emit_signpost(DeprecatedString::formatted("Finished load: {}", url_for_logging), id);
+            dbgln("ResourceLoader: Finished load of: \"{}\", Duration: {}ms", url_for_logging, request.load_time().to_milliseconds());
+            on_complete(true, {});
+        } else {
+            auto load_failed_message = "Load failed"sv;
+            log_failure(request, load_failed_message);
+            on_complete(false, load_failed_message);
+        }
+
+        Platform::EventLoopPlugin::the().deferred_invoke([this, &protocol_request] {
+            m_active_requests.remove(protocol_request);
+        });
+    };
+
+    protocol_request->set_unbuffered_request_callbacks(move(protocol_headers_received), move(on_data_received), move(protocol_complete));
+    protocol_request->on_certificate_requested = []() -> ResourceLoaderConnectorRequest::CertificateAndKey {
+        return {};
+    };
+
+    ++m_pending_loads;
+    if (on_load_counter_change)
+        on_load_counter_change();
+
+    return protocol_request;
+}
+
 bool ResourceLoader::is_port_blocked(int port)
 {
     int ports[] { 1, 7, 9, 11, 13, 15, 17, 19, 20, 21, 22, 23, 25, 37, 42,
@@ -63,6 +63,17 @@ public:
 
     virtual void stream_into(Core::Stream::Stream&) = 0;
 
+    using HeadersReceived = Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code)>;
+    using DataReceived = Function<void(ReadonlyBytes data)>;
+    using RequestFinished = Function<void(bool success, u32 total_size)>;
+
+    // Hands the response payload to `on_data_received` in chunks, as it arrives.
+    // NOTE: Connectors that cannot stream fall back to buffering, and hand over the whole payload as a single chunk.
+    virtual void set_unbuffered_request_callbacks(HeadersReceived, DataReceived, RequestFinished);
+
+    // Asks the connector to stop (or resume) delivering payload chunks, e.g. because nobody is reading them yet.
+    virtual void set_reading_paused(bool) { }
+
     Function<void(bool success, u32 total_size, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> response_code, ReadonlyBytes payload)> on_buffered_request_finish;
     Function<void(bool success, u32 total_size)> on_finish;
     Function<void(Optional<u32> total_size, u32 downloaded_size)> on_progress;
@@ -96,6 +107,14 @@ public:
     void load(LoadRequest&, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback = nullptr, Optional<u32> timeout = {}, Function<void()> timeout_callback = nullptr);
     void load(const AK::URL&, Function<void(ReadonlyBytes, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)> success_callback, Function<void(DeprecatedString const&, Optional<u32> status_code)> error_callback = nullptr, Optional<u32> timeout = {}, Function<void()> timeout_callback = nullptr);
 
+    using OnHeadersReceived = Function<void(HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, Optional<u32> status_code)>;
+    using OnDataReceived = Function<void(ReadonlyBytes data)>;
+    using OnComplete = Function<void(bool success, Optional<StringView> error_message)>;
+
+    // Like load(), but hands the response body over in chunks as it arrives instead of buffering all of it first.
+    // Returns the underlying request for network loads, which can be used to apply backpressure.
+    RefPtr<ResourceLoaderConnectorRequest> load_unbuffered(LoadRequest&, OnHeadersReceived, OnDataReceived, OnComplete);
+
     ResourceLoaderConnector& connector() { return *m_connector; }
 
     void prefetch_dns(AK::URL const&);
@@ -49,10 +49,20 @@ void ImagePaintable::paint(PaintContext& context, PaintPhase phase) const
             if (alt.is_empty())
                 alt = image_element.src();
             context.painter().draw_text(enclosing_rect, alt, Gfx::TextAlignment::Center, computed_values().color(), Gfx::TextElision::Right);
-        } else if (auto bitmap = layout_box().image_loader().bitmap(layout_box().image_loader().current_frame_index())) {
+        } else {
+            auto& image_loader = layout_box().image_loader();
             auto image_rect = context.rounded_device_rect(absolute_rect());
-            ScopedCornerRadiusClip corner_clip { context, context.painter(), image_rect, normalized_border_radii_data(ShrinkRadiiForBorders::Yes) };
-            context.painter().draw_scaled_bitmap(image_rect.to_type<int>(), *bitmap, bitmap->rect(), 1.0f, to_gfx_scaling_mode(computed_values().image_rendering()));
+            auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering());
+
+            // NOTE: When smoothing, we can paint from a pre-scaled version of the image that's closer to the size we're
+            //       painting at. The other scaling modes want the original pixels.
+            auto const* bitmap = scaling_mode == Gfx::Painter::ScalingMode::BilinearBlend
+                ? image_loader.bitmap_for_size(image_loader.current_frame_index(), image_rect.size().to_type<int>())
+                : image_loader.bitmap(image_loader.current_frame_index());
+            if (bitmap) {
+                ScopedCornerRadiusClip corner_clip { context, context.painter(), image_rect, normalized_border_radii_data(ShrinkRadiiForBorders::Yes) };
+                context.painter().draw_scaled_bitmap(image_rect.to_type<int>(), *bitmap, bitmap->rect(), 1.0f, scaling_mode);
+            }
         }
     }
 }
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibWeb/PerformanceRecorder.h>
+
+namespace Web {
+
+StringView performance_phase_name(PerformancePhase phase)
+{
+    switch (phase) {
+#define __ENUMERATE_PERFORMANCE_PHASE(phase, name) \
+    case PerformancePhase::phase:                  \
+        return name##sv;
+        ENUMERATE_PERFORMANCE_PHASES
+#undef __ENUMERATE_PERFORMANCE_PHASE
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+PerformanceRecorder::PerformanceRecorder()
+    : m_origin_time(Time::now_monotonic())
+{
+}
+
+void PerformanceRecorder::begin(PerformancePhase phase)
+{
+    auto index = to_underlying(phase);
+    if (m_nesting_depth[index]++ == 0)
+        m_outermost_start_time[index] = Time::now_monotonic();
+}
+
+void PerformanceRecorder::end(PerformancePhase phase)
+{
+    auto index = to_underlying(phase);
+    // NOTE: A measurement may have begun on another document, e.g. if a window's associated document was replaced while
+    //       a script was running. There is nothing sensible to record in that case.
+    if (m_nesting_depth[index] == 0)
+        return;
+    if (--m_nesting_depth[index] != 0)
+        return;
+
+    auto start = m_outermost_start_time[index];
+    record(phase, start, Time::now_monotonic() - start);
+}
+
+void PerformanceRecorder::record(PerformancePhase phase, Time start, Time duration)
+{
+    auto& totals = m_totals[to_underlying(phase)];
+    ++totals.count;
+    totals.total_duration += duration;
+    totals.max_duration = max(totals.max_duration, duration);
+
+    Record record { phase, start, duration };
+    m_recent_records.enqueue(record);
+
+    if (phase == PerformancePhase::Script && duration >= long_task_threshold) {
+        if (m_long_tasks.size() == max_long_tasks)
+            m_long_tasks.take_first();
+        m_long_tasks.append(record);
+    }
+}
+
+JsonObject PerformanceRecorder::to_json() const
+{
+    JsonObject totals;
+    for (size_t i = 0; i < to_underlying(PerformancePhase::__Count); ++i) {
+        auto const& phase_totals = m_totals[i];
+        JsonObject phase_json;
+        phase_json.set("count", phase_totals.count);
+        phase_json.set("totalMicroseconds", phase_totals.total_duration.to_microseconds());
+        phase_json.set("maxMicroseconds", phase_totals.max_duration.to_microseconds());
+        totals.set(performance_phase_name(static_cast<PerformancePhase>(i)), move(phase_json));
+    }
+
+    JsonArray records;
+    for (auto const& record : m_recent_records) {
+        JsonObject record_json;
+        record_json.set("phase", performance_phase_name(record.phase));
+        record_json.set("startMicroseconds", (record.start - m_origin_time).to_microseconds());
+        record_json.set("durationMicroseconds", record.duration.to_microseconds());
+        records.append(move(record_json));
+    }
+
+    JsonObject json;
+    json.set("totals", move(totals));
+    json.set("longTasks", m_long_tasks.size());
+    json.set("recentRecords", move(records));
+    return json;
+}
+
+void PerformanceRecorder::dump() const
+{
+    dbgln("Performance counters ({}ms since document creation):", (Time::now_monotonic() - m_origin_time).to_milliseconds());
+    for (size_t i = 0; i < to_underlying(PerformancePhase::__Count); ++i) {
+        auto const& phase_totals = m_totals[i];
+        dbgln("  {:20} count: {:6}  total: {:8}us  max: {:8}us",
+            performance_phase_name(static_cast<PerformancePhase>(i)),
+            phase_totals.count,
+            phase_totals.total_duration.to_microseconds(),
+            phase_totals.max_duration.to_microseconds());
+    }
+    dbgln("  long tasks: {}", m_long_tasks.size());
+}
+
+}
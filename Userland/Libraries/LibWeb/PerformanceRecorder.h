@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace Web {
+
+#define ENUMERATE_PERFORMANCE_PHASES                                              \
+    __ENUMERATE_PERFORMANCE_PHASE(Style, "style")                                 \
+    __ENUMERATE_PERFORMANCE_PHASE(Layout, "layout")                               \
+    __ENUMERATE_PERFORMANCE_PHASE(Paint, "paint")                                 \
+    __ENUMERATE_PERFORMANCE_PHASE(GarbageCollection, "garbage-collection")        \
+    __ENUMERATE_PERFORMANCE_PHASE(Script, "script")                               \
+    __ENUMERATE_PERFORMANCE_PHASE(Parsing, "parsing")                             \
+    __ENUMERATE_PERFORMANCE_PHASE(ResourceLoading, "resource-loading")
+
+enum class PerformancePhase : u8 {
+#define __ENUMERATE_PERFORMANCE_PHASE(phase, name) phase,
+    ENUMERATE_PERFORMANCE_PHASES
+#undef __ENUMERATE_PERFORMANCE_PHASE
+        __Count,
+};
+
+StringView performance_phase_name(PerformancePhase);
+
+// Keeps track of where a document spends its time: every style update, layout, paint, garbage collection, script
+// execution, parser run and resource load is timed, the most recent ones are kept in a ring buffer, and all of them
+// are summed up per phase.
+// NOTE: Phases can overlap (e.g. a script running while the parser is paused on it), nested measurements of the same
+//       phase are folded into the outermost one.
+class PerformanceRecorder {
+    AK_MAKE_NONCOPYABLE(PerformanceRecorder);
+    AK_MAKE_NONMOVABLE(PerformanceRecorder);
+
+public:
+    static constexpr size_t ring_buffer_capacity = 512;
+
+    // https://w3c.github.io/longtasks/#sec-terminology
+    static constexpr Time long_task_threshold = Time::from_milliseconds(50);
+
+    struct Record {
+        PerformancePhase phase;
+        Time start;
+        Time duration;
+    };
+
+    struct Totals {
+        size_t count { 0 };
+        Time total_duration;
+        Time max_duration;
+    };
+
+    class Scope {
+        AK_MAKE_NONCOPYABLE(Scope);
+        AK_MAKE_NONMOVABLE(Scope);
+
+    public:
+        Scope(PerformanceRecorder* recorder, PerformancePhase phase)
+            : m_recorder(recorder)
+            , m_phase(phase)
+        {
+            if (m_recorder)
+                m_recorder->begin(m_phase);
+        }
+
+        ~Scope()
+        {
+            if (m_recorder)
+                m_recorder->end(m_phase);
+        }
+
+    private:
+        PerformanceRecorder* m_recorder { nullptr };
+        PerformancePhase m_phase;
+    };
+
+    PerformanceRecorder();
+
+    void begin(PerformancePhase);
+    void end(PerformancePhase);
+    void record(PerformancePhase, Time start, Time duration);
+
+    Time origin_time() const { return m_origin_time; }
+    Totals const& totals(PerformancePhase phase) const { return m_totals[to_underlying(phase)]; }
+    CircularQueue<Record, ring_buffer_capacity> const& recent_records() const { return m_recent_records; }
+
+    // Script runs that took longer than the long task threshold, oldest first.
+    Vector<Record> const& long_tasks() const { return m_long_tasks; }
+
+    JsonObject to_json() const;
+    void dump() const;
+
+private:
+    static constexpr size_t max_long_tasks = 256;
+
+    Time m_origin_time;
+    CircularQueue<Record, ring_buffer_capacity> m_recent_records;
+    Array<Totals, to_underlying(PerformancePhase::__Count)> m_totals;
+    Array<u32, to_underlying(PerformancePhase::__Count)> m_nesting_depth {};
+    Array<Time, to_underlying(PerformancePhase::__Count)> m_outermost_start_time;
+    Vector<Record> m_long_tasks;
+};
+
+}
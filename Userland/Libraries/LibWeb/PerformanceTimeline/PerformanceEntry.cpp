@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::PerformanceTimeline {
+
+JS::NonnullGCPtr<PerformanceEntry> PerformanceEntry::create(JS::Realm& realm, DeprecatedString name, DeprecatedString entry_type, double start_time, double duration)
+{
+    return realm.heap().allocate<PerformanceEntry>(realm, realm, move(name), move(entry_type), start_time, duration);
+}
+
+PerformanceEntry::PerformanceEntry(JS::Realm& realm, DeprecatedString name, DeprecatedString entry_type, double start_time, double duration)
+    : PlatformObject(realm)
+    , m_name(move(name))
+    , m_entry_type(move(entry_type))
+    , m_start_time(start_time)
+    , m_duration(duration)
+{
+    set_prototype(&Bindings::cached_web_prototype(realm, "PerformanceEntry"));
+}
+
+PerformanceEntry::~PerformanceEntry() = default;
+
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+
+namespace Web::PerformanceTimeline {
+
+// https://w3c.github.io/performance-timeline/#the-performanceentry-interface
+class PerformanceEntry : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(PerformanceEntry, Bindings::PlatformObject);
+
+public:
+    static JS::NonnullGCPtr<PerformanceEntry> create(JS::Realm&, DeprecatedString name, DeprecatedString entry_type, double start_time, double duration);
+
+    virtual ~PerformanceEntry() override;
+
+    DeprecatedString const& name() const { return m_name; }
+    DeprecatedString const& entry_type() const { return m_entry_type; }
+    double start_time() const { return m_start_time; }
+    double duration() const { return m_duration; }
+
+protected:
+    PerformanceEntry(JS::Realm&, DeprecatedString name, DeprecatedString entry_type, double start_time, double duration);
+
+private:
+    DeprecatedString m_name;
+    DeprecatedString m_entry_type;
+    double m_start_time { 0 };
+    double m_duration { 0 };
+};
+
+}
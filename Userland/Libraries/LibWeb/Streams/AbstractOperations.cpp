@@ -4,11 +4,38 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/Streams/AbstractOperations.h>
 #include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/Streams/ReadableStreamDefaultController.h>
+#include <LibWeb/Streams/ReadableStreamDefaultReader.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Streams {
 
+// https://streams.spec.whatwg.org/#acquire-readable-stream-reader
+WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> acquire_readable_stream_default_reader(ReadableStream& stream)
+{
+    auto& realm = stream.realm();
+
+    // 1. Let reader be a new ReadableStreamDefaultReader.
+    auto reader = realm.heap().allocate<ReadableStreamDefaultReader>(realm, realm);
+
+    // 2. Perform ? SetUpReadableStreamDefaultReader(reader, stream).
+    TRY(set_up_readable_stream_default_reader(*reader, stream));
+
+    // 3. Return reader.
+    return reader;
+}
+
 // https://streams.spec.whatwg.org/#is-readable-stream-locked
 bool is_readable_stream_locked(ReadableStream const& stream)
 {
@@ -20,4 +47,901 @@ bool is_readable_stream_locked(ReadableStream const& stream)
     return true;
 }
 
+// State shared between the two branches created by ReadableStreamDefaultTee.
+struct TeeState : public RefCounted<TeeState> {
+    JS::NonnullGCPtr<JS::PromiseCapability> pull(JS::Realm&);
+
+    JS::Handle<ReadableStream> stream;
+    JS::Handle<ReadableStreamDefaultReader> reader;
+    bool reading { false };
+    bool read_again { false };
+    bool canceled1 { false };
+    bool canceled2 { false };
+    JS::Handle<JS::Value> reason1;
+    JS::Handle<JS::Value> reason2;
+    JS::Handle<ReadableStream> branch1;
+    JS::Handle<ReadableStream> branch2;
+    JS::Handle<JS::PromiseCapability> cancel_promise;
+};
+
+class TeeReadRequest final : public ReadRequest {
+public:
+    TeeReadRequest(JS::Realm& realm, NonnullRefPtr<TeeState> state)
+        : m_realm(realm)
+        , m_state(move(state))
+    {
+    }
+
+    virtual void on_chunk(JS::Value chunk) override
+    {
+        // 1. Queue a microtask to perform the following steps:
+        // NOTE: The microtask delay here is necessary because it takes at least a microtask to detect errors, when we
+        //       use reader.[[closedPromise]] below. We want errors in stream to error both branches immediately, so we
+        //       cannot let successful synchronously-available reads happen ahead of asynchronously-available errors.
+        HTML::queue_a_microtask(nullptr, [realm = m_realm, state = m_state, chunk = JS::make_handle(chunk)] {
+            // 1. Set readAgain to false.
+            state->read_again = false;
+
+            // 2. Let chunk1 and chunk2 be chunk.
+            // FIXME: 3. If canceled2 is false and cloneForBranch2 is true, clone chunk2.
+
+            // 4. If canceled1 is false, perform ! ReadableStreamDefaultControllerEnqueue(branch1.[[controller]], chunk1).
+            if (!state->canceled1)
+                MUST(readable_stream_default_controller_enqueue(*state->branch1->controller(), chunk.value()));
+
+            // 5. If canceled2 is false, perform ! ReadableStreamDefaultControllerEnqueue(branch2.[[controller]], chunk2).
+            if (!state->canceled2)
+                MUST(readable_stream_default_controller_enqueue(*state->branch2->controller(), chunk.value()));
+
+            // 6. Set reading to false.
+            state->reading = false;
+
+            // 7. If readAgain is true, perform pullAlgorithm.
+            if (state->read_again)
+                state->pull(*realm);
+        });
+    }
+
+    virtual void on_close() override
+    {
+        // 1. Set reading to false.
+        m_state->reading = false;
+
+        // 2. If canceled1 is false, perform ! ReadableStreamDefaultControllerClose(branch1.[[controller]]).
+        if (!m_state->canceled1)
+            readable_stream_default_controller_close(*m_state->branch1->controller());
+
+        // 3. If canceled2 is false, perform ! ReadableStreamDefaultControllerClose(branch2.[[controller]]).
+        if (!m_state->canceled2)
+            readable_stream_default_controller_close(*m_state->branch2->controller());
+
+        // 4. If canceled1 is false or canceled2 is false, resolve cancelPromise with undefined.
+        if (!m_state->canceled1 || !m_state->canceled2)
+            WebIDL::resolve_promise(m_realm->vm(), *m_state->cancel_promise);
+    }
+
+    virtual void on_error(JS::Value) override
+    {
+        // 1. Set reading to false.
+        m_state->reading = false;
+    }
+
+    virtual void visit_edges(JS::Cell::Visitor& visitor) override
+    {
+        visitor.visit(m_realm);
+    }
+
+private:
+    JS::NonnullGCPtr<JS::Realm> m_realm;
+    NonnullRefPtr<TeeState> m_state;
+};
+
+// https://streams.spec.whatwg.org/#abstract-opdef-readablestreamdefaulttee (pullAlgorithm)
+JS::NonnullGCPtr<JS::PromiseCapability> TeeState::pull(JS::Realm& realm)
+{
+    // 1. If reading is true,
+    if (reading) {
+        // 1. Set readAgain to true.
+        read_again = true;
+
+        // 2. Return a promise resolved with undefined.
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // 2. Set reading to true.
+    reading = true;
+
+    // 3. Let readRequest be a read request with the following items:
+    auto read_request = adopt_ref(*new TeeReadRequest(realm, *this));
+
+    // 4. Perform ! ReadableStreamDefaultReaderRead(reader, readRequest).
+    readable_stream_default_reader_read(*reader, move(read_request));
+
+    // 5. Return a promise resolved with undefined.
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+// https://streams.spec.whatwg.org/#abstract-opdef-readablestreamdefaulttee
+// NOTE: cloneForBranch2 is always false, as the only user so far is Fetch, which tees byte streams.
+WebIDL::ExceptionOr<Array<JS::NonnullGCPtr<ReadableStream>, 2>> readable_stream_default_tee(JS::Realm& realm, ReadableStream& stream)
+{
+    // 1. Assert: stream implements ReadableStream.
+    // 2. Assert: cloneForBranch2 is a boolean.
+
+    auto state = adopt_ref(*new TeeState);
+    state->stream = JS::make_handle(stream);
+
+    // 3. Let reader be ? AcquireReadableStreamDefaultReader(stream).
+    state->reader = JS::make_handle(TRY(acquire_readable_stream_default_reader(stream)));
+
+    // 4. Let reading be false.
+    // 5. Let readAgain be false.
+    // 6. Let canceled1 be false.
+    // 7. Let canceled2 be false.
+    // 8. Let reason1 be undefined.
+    // 9. Let reason2 be undefined.
+    // 10. Let branch1 be undefined.
+    // 11. Let branch2 be undefined.
+
+    // 12. Let cancelPromise be a new promise.
+    state->cancel_promise = JS::make_handle(WebIDL::create_promise(realm));
+
+    // 13. Let pullAlgorithm be the following steps:
+    auto make_pull_algorithm = [&realm, state]() -> PullAlgorithm {
+        return [&realm, state]() -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+            return state->pull(realm);
+        };
+    };
+
+    // 14. Let cancel1Algorithm be the following steps, taking a reason argument:
+    // 15. Let cancel2Algorithm be the following steps, taking a reason argument:
+    auto make_cancel_algorithm = [&realm, state](bool is_branch1) -> CancelAlgorithm {
+        return [&realm, state, is_branch1](JS::Value reason) -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+            // 1. Set canceled1 (or canceled2) to true.
+            // 2. Set reason1 (or reason2) to reason.
+            if (is_branch1) {
+                state->canceled1 = true;
+                state->reason1 = JS::make_handle(reason);
+            } else {
+                state->canceled2 = true;
+                state->reason2 = JS::make_handle(reason);
+            }
+
+            // 3. If canceled2 (or canceled1) is true,
+            if (state->canceled1 && state->canceled2) {
+                // 1. Let compositeReason be ! CreateArrayFromList(« reason1, reason2 »).
+                auto composite_reason = JS::Array::create_from(realm, { state->reason1.value(), state->reason2.value() });
+
+                // 2. Let cancelResult be ! ReadableStreamCancel(stream, compositeReason).
+                auto cancel_result = readable_stream_cancel(*state->stream, composite_reason);
+
+                // 3. Resolve cancelPromise with cancelResult.
+                WebIDL::resolve_promise(realm.vm(), *state->cancel_promise, cancel_result->promise());
+            }
+
+            // 4. Return cancelPromise.
+            return JS::NonnullGCPtr { *state->cancel_promise };
+        };
+    };
+
+    // 16. Let startAlgorithm be an algorithm that returns undefined.
+    // 17. Set branch1 to ! CreateReadableStream(startAlgorithm, pullAlgorithm, cancel1Algorithm).
+    auto branch1 = realm.heap().allocate<ReadableStream>(realm, realm);
+    state->branch1 = JS::make_handle(branch1);
+    auto controller1 = realm.heap().allocate<ReadableStreamDefaultController>(realm, realm);
+    TRY(set_up_readable_stream_default_controller(*branch1, *controller1, {}, make_pull_algorithm(), make_cancel_algorithm(true), 1, {}));
+
+    // 18. Set branch2 to ! CreateReadableStream(startAlgorithm, pullAlgorithm, cancel2Algorithm).
+    auto branch2 = realm.heap().allocate<ReadableStream>(realm, realm);
+    state->branch2 = JS::make_handle(branch2);
+    auto controller2 = realm.heap().allocate<ReadableStreamDefaultController>(realm, realm);
+    TRY(set_up_readable_stream_default_controller(*branch2, *controller2, {}, make_pull_algorithm(), make_cancel_algorithm(false), 1, {}));
+
+    // 19. Upon rejection of reader.[[closedPromise]] with reason r,
+    WebIDL::upon_rejection(*state->reader->closed_promise_capability(), [&realm, state](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Perform ! ReadableStreamDefaultControllerError(branch1.[[controller]], r).
+        readable_stream_default_controller_error(*state->branch1->controller(), reason);
+
+        // 2. Perform ! ReadableStreamDefaultControllerError(branch2.[[controller]], r).
+        readable_stream_default_controller_error(*state->branch2->controller(), reason);
+
+        // 3. If canceled1 is false or canceled2 is false, resolve cancelPromise with undefined.
+        if (!state->canceled1 || !state->canceled2)
+            WebIDL::resolve_promise(realm.vm(), *state->cancel_promise);
+
+        return JS::js_undefined();
+    });
+
+    // 20. Return « branch1, branch2 ».
+    return Array<JS::NonnullGCPtr<ReadableStream>, 2> { branch1, branch2 };
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-add-read-request
+void readable_stream_add_read_request(ReadableStream& stream, NonnullRefPtr<ReadRequest> read_request)
+{
+    // 1. Assert: stream.[[reader]] implements ReadableStreamDefaultReader.
+    VERIFY(stream.reader());
+
+    // 2. Assert: stream.[[state]] is "readable".
+    VERIFY(stream.is_readable());
+
+    // 3. Append readRequest to stream.[[reader]].[[readRequests]].
+    stream.reader()->read_requests().append(move(read_request));
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-cancel
+JS::NonnullGCPtr<JS::PromiseCapability> readable_stream_cancel(ReadableStream& stream, JS::Value reason)
+{
+    auto& realm = stream.realm();
+
+    // 1. Set stream.[[disturbed]] to true.
+    stream.set_disturbed(true);
+
+    // 2. If stream.[[state]] is "closed", return a promise resolved with undefined.
+    if (stream.is_closed())
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+
+    // 3. If stream.[[state]] is "errored", return a promise rejected with stream.[[storedError]].
+    if (stream.is_errored())
+        return WebIDL::create_rejected_promise(realm, stream.stored_error());
+
+    // 4. Perform ! ReadableStreamClose(stream).
+    readable_stream_close(stream);
+
+    // FIXME: 5. Let reader be stream.[[reader]].
+    // FIXME: 6. If reader is not undefined and reader implements ReadableStreamBYOBReader, ...
+
+    // 7. Let sourceCancelPromise be ! stream.[[controller]].[[CancelSteps]](reason).
+    auto source_cancel_promise = stream.controller()->cancel_steps(reason);
+
+    // 8. Return the result of reacting to sourceCancelPromise with a fulfillment step that returns undefined.
+    auto react_result = WebIDL::react_to_promise(*source_cancel_promise,
+        [](auto const&) -> WebIDL::ExceptionOr<JS::Value> { return JS::js_undefined(); },
+        {});
+
+    return WebIDL::create_resolved_promise(realm, react_result);
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-close
+void readable_stream_close(ReadableStream& stream)
+{
+    auto& realm = stream.realm();
+
+    // 1. Assert: stream.[[state]] is "readable".
+    VERIFY(stream.is_readable());
+
+    // 2. Set stream.[[state]] to "closed".
+    stream.set_state(ReadableStream::State::Closed);
+
+    // 3. Let reader be stream.[[reader]].
+    auto reader = stream.reader();
+
+    // 4. If reader is undefined, return.
+    if (!reader)
+        return;
+
+    // 5. Resolve reader.[[closedPromise]] with undefined.
+    WebIDL::resolve_promise(realm.vm(), *reader->closed_promise_capability());
+
+    // 6. If reader implements ReadableStreamDefaultReader,
+    // 1. Let readRequests be reader.[[readRequests]].
+    // 2. Set reader.[[readRequests]] to an empty list.
+    auto read_requests = move(reader->read_requests());
+
+    // 3. For each readRequest of readRequests,
+    for (auto& read_request : read_requests) {
+        // 1. Perform readRequest’s close steps.
+        read_request->on_close();
+    }
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-error
+void readable_stream_error(ReadableStream& stream, JS::Value error)
+{
+    auto& realm = stream.realm();
+
+    // 1. Assert: stream.[[state]] is "readable".
+    VERIFY(stream.is_readable());
+
+    // 2. Set stream.[[state]] to "errored".
+    stream.set_state(ReadableStream::State::Errored);
+
+    // 3. Set stream.[[storedError]] to e.
+    stream.set_stored_error(error);
+
+    // 4. Let reader be stream.[[reader]].
+    auto reader = stream.reader();
+
+    // 5. If reader is undefined, return.
+    if (!reader)
+        return;
+
+    // 6. Reject reader.[[closedPromise]] with e.
+    WebIDL::reject_promise(realm.vm(), *reader->closed_promise_capability(), error);
+
+    // 7. Set reader.[[closedPromise]].[[PromiseIsHandled]] to true.
+    WebIDL::mark_promise_as_handled(*reader->closed_promise_capability());
+
+    // 8. If reader implements ReadableStreamDefaultReader, perform ! ReadableStreamDefaultReaderErrorReadRequests(reader, e).
+    readable_stream_default_reader_error_read_requests(*reader, error);
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-fulfill-read-request
+void readable_stream_fulfill_read_request(ReadableStream& stream, JS::Value chunk, bool done)
+{
+    // 1. Assert: ! ReadableStreamHasDefaultReader(stream) is true.
+    VERIFY(readable_stream_has_default_reader(stream));
+
+    // 2. Let reader be stream.[[reader]].
+    auto reader = stream.reader();
+
+    // 3. Assert: reader.[[readRequests]] is not empty.
+    VERIFY(!reader->read_requests().is_empty());
+
+    // 4. Let readRequest be reader.[[readRequests]][0].
+    // 5. Remove readRequest from reader.[[readRequests]].
+    auto read_request = reader->read_requests().take_first();
+
+    // 6. If done is true, perform readRequest’s close steps.
+    if (done)
+        read_request->on_close();
+    // 7. Otherwise, perform readRequest’s chunk steps, given chunk.
+    else
+        read_request->on_chunk(chunk);
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-get-num-read-requests
+size_t readable_stream_get_num_read_requests(ReadableStream const& stream)
+{
+    // 1. Assert: ! ReadableStreamHasDefaultReader(stream) is true.
+    VERIFY(readable_stream_has_default_reader(stream));
+
+    // 2. Return stream.[[reader]].[[readRequests]]'s size.
+    return stream.reader()->read_requests().size();
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-has-default-reader
+bool readable_stream_has_default_reader(ReadableStream const& stream)
+{
+    // 1. Let reader be stream.[[reader]].
+    // 2. If reader is undefined, return false.
+    // 3. If reader implements ReadableStreamDefaultReader, return true.
+    // 4. Return false.
+    // NOTE: ReadableStreamDefaultReader is the only kind of reader so far.
+    return stream.reader() != nullptr;
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-reader-generic-cancel
+JS::NonnullGCPtr<JS::PromiseCapability> readable_stream_reader_generic_cancel(ReadableStreamDefaultReader& reader, JS::Value reason)
+{
+    // 1. Let stream be reader.[[stream]].
+    auto stream = reader.stream();
+
+    // 2. Assert: stream is not undefined.
+    VERIFY(stream);
+
+    // 3. Return ! ReadableStreamCancel(stream, reason).
+    return readable_stream_cancel(*stream, reason);
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-reader-generic-initialize
+void readable_stream_reader_generic_initialize(ReadableStreamDefaultReader& reader, ReadableStream& stream)
+{
+    auto& realm = stream.realm();
+
+    // 1. Set reader.[[stream]] to stream.
+    reader.set_stream(stream);
+
+    // 2. Set stream.[[reader]] to reader.
+    stream.set_reader(reader);
+
+    // 3. If stream.[[state]] is "readable",
+    if (stream.is_readable()) {
+        // 1. Set reader.[[closedPromise]] to a new promise.
+        reader.set_closed_promise_capability(WebIDL::create_promise(realm));
+    }
+    // 4. Otherwise, if stream.[[state]] is "closed",
+    else if (stream.is_closed()) {
+        // 1. Set reader.[[closedPromise]] to a promise resolved with undefined.
+        reader.set_closed_promise_capability(WebIDL::create_resolved_promise(realm, JS::js_undefined()));
+    }
+    // 5. Otherwise,
+    else {
+        // 1. Assert: stream.[[state]] is "errored".
+        VERIFY(stream.is_errored());
+
+        // 2. Set reader.[[closedPromise]] to a promise rejected with stream.[[storedError]].
+        reader.set_closed_promise_capability(WebIDL::create_rejected_promise(realm, stream.stored_error()));
+
+        // 3. Set reader.[[closedPromise]].[[PromiseIsHandled]] to true.
+        WebIDL::mark_promise_as_handled(*reader.closed_promise_capability());
+    }
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-reader-generic-release
+void readable_stream_reader_generic_release(ReadableStreamDefaultReader& reader)
+{
+    // 1. Let stream be reader.[[stream]].
+    auto stream = reader.stream();
+
+    // 2. Assert: stream is not undefined.
+    VERIFY(stream);
+
+    // 3. Assert: stream.[[reader]] is reader.
+    VERIFY(stream->reader().ptr() == &reader);
+
+    auto& realm = stream->realm();
+    auto exception = JS::TypeError::create(realm, "Reader has been released"sv);
+
+    // 4. If stream.[[state]] is "readable", reject reader.[[closedPromise]] with a TypeError exception.
+    if (stream->is_readable())
+        WebIDL::reject_promise(realm.vm(), *reader.closed_promise_capability(), exception);
+    // 5. Otherwise, set reader.[[closedPromise]] to a promise rejected with a TypeError exception.
+    else
+        reader.set_closed_promise_capability(WebIDL::create_rejected_promise(realm, exception));
+
+    // 6. Set reader.[[closedPromise]].[[PromiseIsHandled]] to true.
+    WebIDL::mark_promise_as_handled(*reader.closed_promise_capability());
+
+    // 7. Perform ! stream.[[controller]].[[ReleaseSteps]]().
+    stream->controller()->release_steps();
+
+    // 8. Set stream.[[reader]] to undefined.
+    stream->set_reader({});
+
+    // 9. Set reader.[[stream]] to undefined.
+    reader.set_stream({});
+}
+
+// https://streams.spec.whatwg.org/#abstract-opdef-readablestreamdefaultreadererrorreadrequests
+void readable_stream_default_reader_error_read_requests(ReadableStreamDefaultReader& reader, JS::Value error)
+{
+    // 1. Let readRequests be reader.[[readRequests]].
+    // 2. Set reader.[[readRequests]] to a new empty list.
+    auto read_requests = move(reader.read_requests());
+
+    // 3. For each readRequest of readRequests,
+    for (auto& read_request : read_requests) {
+        // 1. Perform readRequest’s error steps, given e.
+        read_request->on_error(error);
+    }
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-reader-read
+void readable_stream_default_reader_read(ReadableStreamDefaultReader& reader, NonnullRefPtr<ReadRequest> read_request)
+{
+    // 1. Let stream be reader.[[stream]].
+    auto stream = reader.stream();
+
+    // 2. Assert: stream is not undefined.
+    VERIFY(stream);
+
+    // 3. Set stream.[[disturbed]] to true.
+    stream->set_disturbed(true);
+
+    // 4. If stream.[[state]] is "closed", perform readRequest’s close steps.
+    if (stream->is_closed()) {
+        read_request->on_close();
+    }
+    // 5. Otherwise, if stream.[[state]] is "errored", perform readRequest’s error steps given stream.[[storedError]].
+    else if (stream->is_errored()) {
+        read_request->on_error(stream->stored_error());
+    }
+    // 6. Otherwise,
+    else {
+        // 1. Assert: stream.[[state]] is "readable".
+        VERIFY(stream->is_readable());
+
+        // 2. Perform ! stream.[[controller]].[[PullSteps]](readRequest).
+        stream->controller()->pull_steps(move(read_request));
+    }
+}
+
+// https://streams.spec.whatwg.org/#abstract-opdef-readablestreamdefaultreaderrelease
+void readable_stream_default_reader_release(ReadableStreamDefaultReader& reader)
+{
+    // 1. Perform ! ReadableStreamReaderGenericRelease(reader).
+    readable_stream_reader_generic_release(reader);
+
+    // 2. Let e be a new TypeError exception.
+    auto exception = JS::TypeError::create(reader.realm(), "Reader has been released"sv);
+
+    // 3. Perform ! ReadableStreamDefaultReaderErrorReadRequests(reader, e).
+    readable_stream_default_reader_error_read_requests(reader, exception);
+}
+
+// https://streams.spec.whatwg.org/#set-up-readable-stream-default-reader
+WebIDL::ExceptionOr<void> set_up_readable_stream_default_reader(ReadableStreamDefaultReader& reader, ReadableStream& stream)
+{
+    // 1. If ! IsReadableStreamLocked(stream) is true, throw a TypeError exception.
+    if (is_readable_stream_locked(stream))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Cannot create stream reader for a locked stream"sv };
+
+    // 2. Perform ! ReadableStreamReaderGenericInitialize(reader, stream).
+    readable_stream_reader_generic_initialize(reader, stream);
+
+    // 3. Set reader.[[readRequests]] to a new empty list.
+    reader.read_requests().clear();
+
+    return {};
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-call-pull-if-needed
+void readable_stream_default_controller_call_pull_if_needed(ReadableStreamDefaultController& controller)
+{
+    // 1. Let shouldPull be ! ReadableStreamDefaultControllerShouldCallPull(controller).
+    auto should_pull = readable_stream_default_controller_should_call_pull(controller);
+
+    // 2. If shouldPull is false, return.
+    if (!should_pull)
+        return;
+
+    // 3. If controller.[[pulling]] is true,
+    if (controller.pulling()) {
+        // 1. Set controller.[[pullAgain]] to true.
+        controller.set_pull_again(true);
+
+        // 2. Return.
+        return;
+    }
+
+    // 4. Assert: controller.[[pullAgain]] is false.
+    VERIFY(!controller.pull_again());
+
+    // 5. Set controller.[[pulling]] to true.
+    controller.set_pulling(true);
+
+    // 6. Let pullPromise be the result of performing controller.[[pullAlgorithm]].
+    auto pull_promise = MUST(controller.pull_algorithm()());
+
+    // 7. Upon fulfillment of pullPromise,
+    WebIDL::upon_fulfillment(*pull_promise, [controller = JS::make_handle(controller)](auto const&) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Set controller.[[pulling]] to false.
+        controller->set_pulling(false);
+
+        // 2. If controller.[[pullAgain]] is true,
+        if (controller->pull_again()) {
+            // 1. Set controller.[[pullAgain]] to false.
+            controller->set_pull_again(false);
+
+            // 2. Perform ! ReadableStreamDefaultControllerCallPullIfNeeded(controller).
+            readable_stream_default_controller_call_pull_if_needed(*controller);
+        }
+
+        return JS::js_undefined();
+    });
+
+    // 8. Upon rejection of pullPromise with reason e,
+    WebIDL::upon_rejection(*pull_promise, [controller = JS::make_handle(controller)](auto const& error) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Perform ! ReadableStreamDefaultControllerError(controller, e).
+        readable_stream_default_controller_error(*controller, error);
+
+        return JS::js_undefined();
+    });
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-should-call-pull
+bool readable_stream_default_controller_should_call_pull(ReadableStreamDefaultController const& controller)
+{
+    // 1. Let stream be controller.[[stream]].
+    auto const& stream = *controller.stream();
+
+    // 2. If ! ReadableStreamDefaultControllerCanCloseOrEnqueue(controller) is false, return false.
+    if (!readable_stream_default_controller_can_close_or_enqueue(controller))
+        return false;
+
+    // 3. If controller.[[started]] is false, return false.
+    if (!controller.started())
+        return false;
+
+    // 4. If ! IsReadableStreamLocked(stream) is true and ! ReadableStreamGetNumReadRequests(stream) > 0, return true.
+    if (is_readable_stream_locked(stream) && readable_stream_get_num_read_requests(stream) > 0)
+        return true;
+
+    // 5. Let desiredSize be ! ReadableStreamDefaultControllerGetDesiredSize(controller).
+    auto desired_size = readable_stream_default_controller_get_desired_size(controller);
+
+    // 6. Assert: desiredSize is not null.
+    VERIFY(desired_size.has_value());
+
+    // 7. If desiredSize > 0, return true.
+    // 8. Return false.
+    return *desired_size > 0;
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-clear-algorithms
+void readable_stream_default_controller_clear_algorithms(ReadableStreamDefaultController& controller)
+{
+    // 1. Set controller.[[pullAlgorithm]] to undefined.
+    // 2. Set controller.[[cancelAlgorithm]] to undefined.
+    // 3. Set controller.[[strategySizeAlgorithm]] to undefined.
+    // NOTE: This may happen while one of the algorithms is running (e.g. a tee branch being closed from within its own
+    //       pull algorithm), in which case SafeFunction defers destroying it until the call returns.
+    controller.pull_algorithm() = nullptr;
+    controller.cancel_algorithm() = nullptr;
+    controller.strategy_size_algorithm() = nullptr;
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-close
+void readable_stream_default_controller_close(ReadableStreamDefaultController& controller)
+{
+    // 1. If ! ReadableStreamDefaultControllerCanCloseOrEnqueue(controller) is false, return.
+    if (!readable_stream_default_controller_can_close_or_enqueue(controller))
+        return;
+
+    // 2. Let stream be controller.[[stream]].
+    auto& stream = *controller.stream();
+
+    // 3. Set controller.[[closeRequested]] to true.
+    controller.set_close_requested(true);
+
+    // 4. If controller.[[queue]] is empty,
+    if (controller.queue().is_empty()) {
+        // 1. Perform ! ReadableStreamDefaultControllerClearAlgorithms(controller).
+        readable_stream_default_controller_clear_algorithms(controller);
+
+        // 2. Perform ! ReadableStreamClose(stream).
+        readable_stream_close(stream);
+    }
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-enqueue
+WebIDL::ExceptionOr<void> readable_stream_default_controller_enqueue(ReadableStreamDefaultController& controller, JS::Value chunk)
+{
+    // 1. If ! ReadableStreamDefaultControllerCanCloseOrEnqueue(controller) is false, return.
+    if (!readable_stream_default_controller_can_close_or_enqueue(controller))
+        return {};
+
+    // 2. Let stream be controller.[[stream]].
+    auto& stream = *controller.stream();
+
+    // 3. If ! IsReadableStreamLocked(stream) is true and ! ReadableStreamGetNumReadRequests(stream) > 0, perform
+    //    ! ReadableStreamFulfillReadRequest(stream, chunk, false).
+    if (is_readable_stream_locked(stream) && readable_stream_get_num_read_requests(stream) > 0) {
+        readable_stream_fulfill_read_request(stream, chunk, false);
+    }
+    // 4. Otherwise,
+    else {
+        // 1. Let result be the result of performing controller.[[strategySizeAlgorithm]], passing in chunk, and
+        //    interpreting the result as a completion record.
+        // FIXME: Size algorithms from JS can throw, see steps 2 and 3.
+        // 3. Let chunkSize be result.[[Value]].
+        auto chunk_size = controller.strategy_size_algorithm()(chunk);
+
+        // 4. Let enqueueResult be EnqueueValueWithSize(controller, chunk, chunkSize).
+        // https://streams.spec.whatwg.org/#enqueue-value-with-size
+        // 3. If ! IsNonNegativeNumber(size) is false, throw a RangeError exception.
+        // 4. If size is +∞, throw a RangeError exception.
+        if (isnan(chunk_size) || chunk_size < 0 || isinf(chunk_size)) {
+            // 5. If enqueueResult is an abrupt completion,
+            auto exception = JS::RangeError::create(controller.realm(), "Chunk has non-positive or infinite size"sv);
+
+            // 1. Perform ! ReadableStreamDefaultControllerError(controller, enqueueResult.[[Value]]).
+            readable_stream_default_controller_error(controller, exception);
+
+            // 2. Return enqueueResult.
+            return JS::throw_completion(exception);
+        }
+
+        // 5. Append a new value-with-size with value value and size size to container.[[queue]].
+        controller.queue().append({ chunk, chunk_size });
+
+        // 6. Set container.[[queueTotalSize]] to container.[[queueTotalSize]] + size.
+        controller.set_queue_total_size(controller.queue_total_size() + chunk_size);
+    }
+
+    // 5. Perform ! ReadableStreamDefaultControllerCallPullIfNeeded(controller).
+    readable_stream_default_controller_call_pull_if_needed(controller);
+
+    return {};
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-error
+void readable_stream_default_controller_error(ReadableStreamDefaultController& controller, JS::Value error)
+{
+    // 1. Let stream be controller.[[stream]].
+    auto& stream = *controller.stream();
+
+    // 2. If stream.[[state]] is not "readable", return.
+    if (!stream.is_readable())
+        return;
+
+    // 3. Perform ! ResetQueue(controller).
+    controller.queue().clear();
+    controller.set_queue_total_size(0);
+
+    // 4. Perform ! ReadableStreamDefaultControllerClearAlgorithms(controller).
+    readable_stream_default_controller_clear_algorithms(controller);
+
+    // 5. Perform ! ReadableStreamError(stream, e).
+    readable_stream_error(stream, error);
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-get-desired-size
+Optional<double> readable_stream_default_controller_get_desired_size(ReadableStreamDefaultController const& controller)
+{
+    auto const& stream = *controller.stream();
+
+    // 1. Let state be controller.[[stream]].[[state]].
+    // 2. If state is "errored", return null.
+    if (stream.is_errored())
+        return {};
+
+    // 3. If state is "closed", return 0.
+    if (stream.is_closed())
+        return 0.0;
+
+    // 4. Return controller.[[strategyHWM]] − controller.[[queueTotalSize]].
+    return controller.strategy_hwm() - controller.queue_total_size();
+}
+
+// https://streams.spec.whatwg.org/#readable-stream-default-controller-can-close-or-enqueue
+bool readable_stream_default_controller_can_close_or_enqueue(ReadableStreamDefaultController const& controller)
+{
+    // 1. Let state be controller.[[stream]].[[state]].
+    // 2. If controller.[[closeRequested]] is false and state is "readable", return true.
+    // 3. Otherwise, return false.
+    return !controller.close_requested() && controller.stream()->is_readable();
+}
+
+// https://streams.spec.whatwg.org/#set-up-readable-stream-default-controller
+WebIDL::ExceptionOr<void> set_up_readable_stream_default_controller(ReadableStream& stream, ReadableStreamDefaultController& controller, StartAlgorithm start_algorithm, PullAlgorithm pull_algorithm, CancelAlgorithm cancel_algorithm, double high_water_mark, SizeAlgorithm size_algorithm)
+{
+    auto& realm = stream.realm();
+
+    // 1. Assert: stream.[[controller]] is undefined.
+    VERIFY(!stream.controller());
+
+    // 2. Set controller.[[stream]] to stream.
+    controller.set_stream(stream);
+
+    // 3. Perform ! ResetQueue(controller).
+    controller.queue().clear();
+    controller.set_queue_total_size(0);
+
+    // 4. Set controller.[[started]], controller.[[closeRequested]], controller.[[pullAgain]], and controller.[[pulling]] to false.
+    controller.set_started(false);
+    controller.set_close_requested(false);
+    controller.set_pull_again(false);
+    controller.set_pulling(false);
+
+    // 5. Set controller.[[strategySizeAlgorithm]] to sizeAlgorithm and controller.[[strategyHWM]] to highWaterMark.
+    // NOTE: A missing size algorithm is treated like one that returns 1, i.e. a count queuing strategy.
+    if (!size_algorithm)
+        size_algorithm = SizeAlgorithm { [](JS::Value) { return 1.0; } };
+    controller.set_strategy_size_algorithm(move(size_algorithm));
+    controller.set_strategy_hwm(high_water_mark);
+
+    // 6. Set controller.[[pullAlgorithm]] to pullAlgorithm.
+    controller.set_pull_algorithm(move(pull_algorithm));
+
+    // 7. Set controller.[[cancelAlgorithm]] to cancelAlgorithm.
+    controller.set_cancel_algorithm(move(cancel_algorithm));
+
+    // 8. Set stream.[[controller]] to controller.
+    stream.set_controller(controller);
+
+    // 9. Let startResult be the result of performing startAlgorithm. (This might throw an exception.)
+    auto start_result = start_algorithm ? TRY(start_algorithm()) : JS::js_undefined();
+
+    // 10. Let startPromise be a promise resolved with startResult.
+    auto start_promise = WebIDL::create_resolved_promise(realm, start_result);
+
+    // 11. Upon fulfillment of startPromise,
+    WebIDL::upon_fulfillment(start_promise, [controller = JS::make_handle(controller)](auto const&) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Set controller.[[started]] to true.
+        controller->set_started(true);
+
+        // 2. Assert: controller.[[pulling]] is false.
+        VERIFY(!controller->pulling());
+
+        // 3. Assert: controller.[[pullAgain]] is false.
+        VERIFY(!controller->pull_again());
+
+        // 4. Perform ! ReadableStreamDefaultControllerCallPullIfNeeded(controller).
+        readable_stream_default_controller_call_pull_if_needed(*controller);
+
+        return JS::js_undefined();
+    });
+
+    // 12. Upon rejection of startPromise with reason r,
+    WebIDL::upon_rejection(start_promise, [controller = JS::make_handle(controller)](auto const& error) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Perform ! ReadableStreamDefaultControllerError(controller, r).
+        readable_stream_default_controller_error(*controller, error);
+
+        return JS::js_undefined();
+    });
+
+    return {};
+}
+
+// https://streams.spec.whatwg.org/#readablestream-set-up
+WebIDL::ExceptionOr<void> set_up_readable_stream(ReadableStream& stream, PullAlgorithm pull_algorithm, CancelAlgorithm cancel_algorithm, double high_water_mark, SizeAlgorithm size_algorithm)
+{
+    auto& realm = stream.realm();
+
+    // 1. Let startAlgorithm be an algorithm that returns undefined.
+
+    // 2. Let pullAlgorithmWrapper be an algorithm that runs these steps:
+    //    1. Let result be the result of running pullAlgorithm, if pullAlgorithm was given, or null otherwise. If this
+    //       throws an exception e, return a promise rejected with e.
+    //    2. If result is a Promise, then return result.
+    //    3. Return a promise resolved with undefined.
+    PullAlgorithm pull_algorithm_wrapper = [&realm, pull_algorithm = move(pull_algorithm)]() -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+        if (!pull_algorithm)
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        auto result = pull_algorithm();
+        if (result.is_error())
+            return WebIDL::create_rejected_promise(realm, *Bindings::Detail::dom_exception_to_throw_completion(realm.vm(), result.release_error()).value());
+        return result;
+    };
+
+    // 3. Let cancelAlgorithmWrapper be an algorithm that runs these steps:
+    //    1. Let result be the result of running cancelAlgorithm, if cancelAlgorithm was given, or null otherwise. If
+    //       this throws an exception e, return a promise rejected with e.
+    //    2. If result is a Promise, then return result.
+    //    3. Return a promise resolved with undefined.
+    CancelAlgorithm cancel_algorithm_wrapper = [&realm, cancel_algorithm = move(cancel_algorithm)](JS::Value reason) -> WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>> {
+        if (!cancel_algorithm)
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        auto result = cancel_algorithm(reason);
+        if (result.is_error())
+            return WebIDL::create_rejected_promise(realm, *Bindings::Detail::dom_exception_to_throw_completion(realm.vm(), result.release_error()).value());
+        return result;
+    };
+
+    // 4. If sizeAlgorithm was not given, then set it to an algorithm that returns 1.
+    // NOTE: This is done in SetUpReadableStreamDefaultController.
+
+    // 5. Perform ! InitializeReadableStream(stream).
+    // NOTE: The stream's state, reader, stored error and disturbed flag are initialized in the constructor.
+
+    // 6. Let controller be a new ReadableStreamDefaultController.
+    auto controller = realm.heap().allocate<ReadableStreamDefaultController>(realm, realm);
+
+    // 7. Perform ! SetUpReadableStreamDefaultController(stream, controller, startAlgorithm, pullAlgorithmWrapper,
+    //    cancelAlgorithmWrapper, highWaterMark, sizeAlgorithm).
+    return set_up_readable_stream_default_controller(stream, *controller, {}, move(pull_algorithm_wrapper), move(cancel_algorithm_wrapper), high_water_mark, move(size_algorithm));
+}
+
+// https://streams.spec.whatwg.org/#readablestream-enqueue
+WebIDL::ExceptionOr<void> readable_stream_enqueue(ReadableStream& stream, JS::Value chunk)
+{
+    // 1. If stream.[[controller]] implements ReadableStreamDefaultController,
+    //    1. Perform ! ReadableStreamDefaultControllerEnqueue(stream.[[controller]], chunk).
+    // FIXME: 2. Otherwise, ... (ReadableByteStreamController)
+    return readable_stream_default_controller_enqueue(*stream.controller(), chunk);
+}
+
+WebIDL::ExceptionOr<void> readable_stream_enqueue_bytes(ReadableStream& stream, ReadonlyBytes bytes)
+{
+    auto& realm = stream.realm();
+
+    auto buffer = TRY_OR_THROW_OOM(realm.vm(), ByteBuffer::copy(bytes));
+    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+    auto chunk = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+    return readable_stream_enqueue(stream, chunk);
+}
+
+// https://streams.spec.whatwg.org/#readablestream-close
+void readable_stream_close_for_other_specifications(ReadableStream& stream)
+{
+    // 1. If stream.[[controller]] implements ReadableByteStreamController, ...
+    // FIXME: ReadableByteStreamController is not implemented.
+
+    // 2. Otherwise, perform ! ReadableStreamDefaultControllerClose(stream.[[controller]]).
+    readable_stream_default_controller_close(*stream.controller());
+}
+
+// https://streams.spec.whatwg.org/#readablestream-error
+void readable_stream_error_for_other_specifications(ReadableStream& stream, JS::Value error)
+{
+    // 1. If stream.[[controller]] implements ReadableByteStreamController, ...
+    // FIXME: ReadableByteStreamController is not implemented.
+
+    // 2. Otherwise, perform ! ReadableStreamDefaultControllerError(stream.[[controller]], e).
+    readable_stream_default_controller_error(*stream.controller(), error);
+}
+
 }
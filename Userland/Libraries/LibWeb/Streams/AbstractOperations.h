@@ -6,10 +6,64 @@
 
 #pragma once
 
+#include <AK/Forward.h>
+#include <LibJS/Forward.h>
+#include <LibJS/SafeFunction.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::Streams {
 
+using StartAlgorithm = JS::SafeFunction<WebIDL::ExceptionOr<JS::Value>()>;
+using PullAlgorithm = JS::SafeFunction<WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>>()>;
+using CancelAlgorithm = JS::SafeFunction<WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PromiseCapability>>(JS::Value)>;
+using SizeAlgorithm = JS::SafeFunction<double(JS::Value)>;
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> acquire_readable_stream_default_reader(ReadableStream&);
 bool is_readable_stream_locked(ReadableStream const&);
+WebIDL::ExceptionOr<Array<JS::NonnullGCPtr<ReadableStream>, 2>> readable_stream_default_tee(JS::Realm&, ReadableStream&);
+
+void readable_stream_add_read_request(ReadableStream&, NonnullRefPtr<ReadRequest>);
+JS::NonnullGCPtr<JS::PromiseCapability> readable_stream_cancel(ReadableStream&, JS::Value reason);
+void readable_stream_close(ReadableStream&);
+void readable_stream_error(ReadableStream&, JS::Value error);
+void readable_stream_fulfill_read_request(ReadableStream&, JS::Value chunk, bool done);
+size_t readable_stream_get_num_read_requests(ReadableStream const&);
+bool readable_stream_has_default_reader(ReadableStream const&);
+
+JS::NonnullGCPtr<JS::PromiseCapability> readable_stream_reader_generic_cancel(ReadableStreamDefaultReader&, JS::Value reason);
+void readable_stream_reader_generic_initialize(ReadableStreamDefaultReader&, ReadableStream&);
+void readable_stream_reader_generic_release(ReadableStreamDefaultReader&);
+
+void readable_stream_default_reader_error_read_requests(ReadableStreamDefaultReader&, JS::Value error);
+void readable_stream_default_reader_read(ReadableStreamDefaultReader&, NonnullRefPtr<ReadRequest>);
+void readable_stream_default_reader_release(ReadableStreamDefaultReader&);
+WebIDL::ExceptionOr<void> set_up_readable_stream_default_reader(ReadableStreamDefaultReader&, ReadableStream&);
+
+void readable_stream_default_controller_call_pull_if_needed(ReadableStreamDefaultController&);
+bool readable_stream_default_controller_should_call_pull(ReadableStreamDefaultController const&);
+void readable_stream_default_controller_clear_algorithms(ReadableStreamDefaultController&);
+void readable_stream_default_controller_close(ReadableStreamDefaultController&);
+WebIDL::ExceptionOr<void> readable_stream_default_controller_enqueue(ReadableStreamDefaultController&, JS::Value chunk);
+void readable_stream_default_controller_error(ReadableStreamDefaultController&, JS::Value error);
+Optional<double> readable_stream_default_controller_get_desired_size(ReadableStreamDefaultController const&);
+bool readable_stream_default_controller_can_close_or_enqueue(ReadableStreamDefaultController const&);
+WebIDL::ExceptionOr<void> set_up_readable_stream_default_controller(ReadableStream&, ReadableStreamDefaultController&, StartAlgorithm, PullAlgorithm, CancelAlgorithm, double high_water_mark, SizeAlgorithm);
+
+// https://streams.spec.whatwg.org/#readablestream-set-up
+// NOTE: This is how other specifications create streams whose chunks are produced by native code.
+WebIDL::ExceptionOr<void> set_up_readable_stream(ReadableStream&, PullAlgorithm = {}, CancelAlgorithm = {}, double high_water_mark = 1, SizeAlgorithm = {});
+
+// https://streams.spec.whatwg.org/#readablestream-enqueue
+WebIDL::ExceptionOr<void> readable_stream_enqueue(ReadableStream&, JS::Value chunk);
+
+// NOTE: This is what specifications mean by "enqueue a Uint8Array wrapping an ArrayBuffer containing bytes".
+WebIDL::ExceptionOr<void> readable_stream_enqueue_bytes(ReadableStream&, ReadonlyBytes);
+
+// https://streams.spec.whatwg.org/#readablestream-close
+void readable_stream_close_for_other_specifications(ReadableStream&);
+
+// https://streams.spec.whatwg.org/#readablestream-error
+void readable_stream_error_for_other_specifications(ReadableStream&, JS::Value error);
 
 }
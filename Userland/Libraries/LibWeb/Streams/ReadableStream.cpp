@@ -4,10 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/PromiseCapability.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Streams/AbstractOperations.h>
 #include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/Streams/ReadableStreamDefaultController.h>
+#include <LibWeb/Streams/ReadableStreamDefaultReader.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Streams {
 
@@ -25,6 +29,37 @@ ReadableStream::ReadableStream(JS::Realm& realm)
 
 ReadableStream::~ReadableStream() = default;
 
+// https://streams.spec.whatwg.org/#rs-locked
+bool ReadableStream::locked() const
+{
+    // 1. Return ! IsReadableStreamLocked(this).
+    return is_readable_stream_locked(*this);
+}
+
+// https://streams.spec.whatwg.org/#rs-cancel
+JS::NonnullGCPtr<JS::Object> ReadableStream::cancel(JS::Value reason)
+{
+    auto& realm = this->realm();
+
+    // 1. If ! IsReadableStreamLocked(this) is true, return a promise rejected with a TypeError exception.
+    if (is_readable_stream_locked(*this)) {
+        auto exception = JS::TypeError::create(realm, "Cannot cancel a locked stream"sv);
+        return *WebIDL::create_rejected_promise(realm, exception)->promise();
+    }
+
+    // 2. Return ! ReadableStreamCancel(this, reason).
+    return *readable_stream_cancel(*this, reason)->promise();
+}
+
+// https://streams.spec.whatwg.org/#rs-get-reader
+WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> ReadableStream::get_reader()
+{
+    // FIXME: 1. If options["mode"] does not exist, return ? AcquireReadableStreamDefaultReader(this).
+    // FIXME: 2. Assert: options["mode"] is "byob".
+    // FIXME: 3. Return ? AcquireReadableStreamBYOBReader(this).
+    return TRY(acquire_readable_stream_default_reader(*this));
+}
+
 void ReadableStream::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
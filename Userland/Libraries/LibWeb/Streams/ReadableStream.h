@@ -28,9 +28,23 @@ public:
 
     virtual ~ReadableStream() override;
 
-    JS::GCPtr<JS::Object> controller() const { return m_controller; }
-    JS::GCPtr<JS::Object> reader() const { return m_reader; }
+    bool locked() const;
+    JS::NonnullGCPtr<JS::Object> cancel(JS::Value reason);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> get_reader();
+
+    JS::GCPtr<ReadableStreamDefaultController> controller() const { return m_controller; }
+    void set_controller(JS::GCPtr<ReadableStreamDefaultController> value) { m_controller = value; }
+
+    JS::GCPtr<ReadableStreamDefaultReader> reader() const { return m_reader; }
+    void set_reader(JS::GCPtr<ReadableStreamDefaultReader> value) { m_reader = value; }
+
     JS::Value stored_error() const { return m_stored_error; }
+    void set_stored_error(JS::Value value) { m_stored_error = value; }
+
+    State state() const { return m_state; }
+    void set_state(State value) { m_state = value; }
+
+    void set_disturbed(bool value) { m_disturbed = value; }
 
     bool is_readable() const;
     bool is_closed() const;
@@ -45,7 +59,8 @@ private:
 
     // https://streams.spec.whatwg.org/#readablestream-controller
     // A ReadableStreamDefaultController or ReadableByteStreamController created with the ability to control the state and queue of this stream
-    JS::GCPtr<JS::Object> m_controller;
+    // FIXME: Add support for ReadableByteStreamController.
+    JS::GCPtr<ReadableStreamDefaultController> m_controller;
 
     // https://streams.spec.whatwg.org/#readablestream-detached
     // A boolean flag set to true when the stream is transferred
@@ -57,7 +72,8 @@ private:
 
     // https://streams.spec.whatwg.org/#readablestream-reader
     // A ReadableStreamDefaultReader or ReadableStreamBYOBReader instance, if the stream is locked to a reader, or undefined if it is not
-    JS::GCPtr<JS::Object> m_reader;
+    // FIXME: Add support for ReadableStreamBYOBReader.
+    JS::GCPtr<ReadableStreamDefaultReader> m_reader;
 
     // https://streams.spec.whatwg.org/#readablestream-state
     // A string containing the stream’s current state, used internally; one of "readable", "closed", or "errored"
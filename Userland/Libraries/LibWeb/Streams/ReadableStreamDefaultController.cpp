@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/Streams/ReadableStreamDefaultController.h>
+#include <LibWeb/Streams/ReadableStreamDefaultReader.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::Streams {
+
+ReadableStreamDefaultController::ReadableStreamDefaultController(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+    set_prototype(&Bindings::cached_web_prototype(realm, "ReadableStreamDefaultController"));
+}
+
+ReadableStreamDefaultController::~ReadableStreamDefaultController() = default;
+
+void ReadableStreamDefaultController::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto const& item : m_queue)
+        visitor.visit(item.value);
+    visitor.visit(m_stream);
+}
+
+// https://streams.spec.whatwg.org/#rs-default-controller-close
+WebIDL::ExceptionOr<void> ReadableStreamDefaultController::close()
+{
+    // 1. If ! ReadableStreamDefaultControllerCanCloseOrEnqueue(this) is false, throw a TypeError exception.
+    if (!readable_stream_default_controller_can_close_or_enqueue(*this))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Stream is not closable"sv };
+
+    // 2. Perform ! ReadableStreamDefaultControllerClose(this).
+    readable_stream_default_controller_close(*this);
+    return {};
+}
+
+// https://streams.spec.whatwg.org/#rs-default-controller-enqueue
+WebIDL::ExceptionOr<void> ReadableStreamDefaultController::enqueue(JS::Value chunk)
+{
+    // 1. If ! ReadableStreamDefaultControllerCanCloseOrEnqueue(this) is false, throw a TypeError exception.
+    if (!readable_stream_default_controller_can_close_or_enqueue(*this))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Cannot enqueue chunk to stream"sv };
+
+    // 2. Perform ? ReadableStreamDefaultControllerEnqueue(this, chunk).
+    return readable_stream_default_controller_enqueue(*this, chunk);
+}
+
+// https://streams.spec.whatwg.org/#rs-default-controller-error
+void ReadableStreamDefaultController::error(JS::Value error)
+{
+    // 1. Perform ! ReadableStreamDefaultControllerError(this, e).
+    readable_stream_default_controller_error(*this, error);
+}
+
+// https://streams.spec.whatwg.org/#rs-default-controller-private-cancel
+JS::NonnullGCPtr<JS::PromiseCapability> ReadableStreamDefaultController::cancel_steps(JS::Value reason)
+{
+    // 1. Perform ! ResetQueue(this).
+    m_queue.clear();
+    m_queue_total_size = 0;
+
+    // 2. Let result be the result of performing this.[[cancelAlgorithm]], passing reason.
+    // NOTE: The algorithms are cleared once the stream has closed or errored, but canceling such a stream doesn't get here.
+    VERIFY(m_cancel_algorithm);
+    auto result = MUST(m_cancel_algorithm(reason));
+
+    // 3. Perform ! ReadableStreamDefaultControllerClearAlgorithms(this).
+    readable_stream_default_controller_clear_algorithms(*this);
+
+    // 4. Return result.
+    return result;
+}
+
+// https://streams.spec.whatwg.org/#rs-default-controller-private-pull
+void ReadableStreamDefaultController::pull_steps(NonnullRefPtr<ReadRequest> read_request)
+{
+    // 1. Let stream be this.[[stream]].
+    auto& stream = *m_stream;
+
+    // 2. If this.[[queue]] is not empty,
+    if (!m_queue.is_empty()) {
+        // 1. Let chunk be ! DequeueValue(this).
+        auto value_with_size = m_queue.take_first();
+        m_queue_total_size = max(m_queue_total_size - value_with_size.size, 0.0);
+        auto chunk = value_with_size.value;
+
+        // 2. If this.[[closeRequested]] is true and this.[[queue]] is empty,
+        if (m_close_requested && m_queue.is_empty()) {
+            // 1. Perform ! ReadableStreamDefaultControllerClearAlgorithms(this).
+            readable_stream_default_controller_clear_algorithms(*this);
+
+            // 2. Perform ! ReadableStreamClose(stream).
+            readable_stream_close(stream);
+        }
+        // 3. Otherwise, perform ! ReadableStreamDefaultControllerCallPullIfNeeded(this).
+        else {
+            readable_stream_default_controller_call_pull_if_needed(*this);
+        }
+
+        // 4. Perform readRequest’s chunk steps, given chunk.
+        read_request->on_chunk(chunk);
+    }
+    // 3. Otherwise,
+    else {
+        // 1. Perform ! ReadableStreamAddReadRequest(stream, readRequest).
+        readable_stream_add_read_request(stream, move(read_request));
+
+        // 2. Perform ! ReadableStreamDefaultControllerCallPullIfNeeded(this).
+        readable_stream_default_controller_call_pull_if_needed(*this);
+    }
+}
+
+// https://streams.spec.whatwg.org/#abstract-opdef-readablestreamdefaultcontroller-releasesteps
+void ReadableStreamDefaultController::release_steps()
+{
+    // 1. Return.
+}
+
+}
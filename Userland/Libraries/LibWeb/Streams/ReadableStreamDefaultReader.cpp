@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/IteratorOperations.h>
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/Streams/ReadableStreamDefaultReader.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Streams {
+
+// https://streams.spec.whatwg.org/#default-reader-constructor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> ReadableStreamDefaultReader::construct_impl(JS::Realm& realm, ReadableStream& stream)
+{
+    auto reader = realm.heap().allocate<ReadableStreamDefaultReader>(realm, realm);
+
+    // 1. Perform ? SetUpReadableStreamDefaultReader(this, stream).
+    TRY(set_up_readable_stream_default_reader(*reader, stream));
+
+    return reader;
+}
+
+ReadableStreamDefaultReader::ReadableStreamDefaultReader(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+    set_prototype(&Bindings::cached_web_prototype(realm, "ReadableStreamDefaultReader"));
+}
+
+ReadableStreamDefaultReader::~ReadableStreamDefaultReader() = default;
+
+void ReadableStreamDefaultReader::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_closed_promise);
+    for (auto& read_request : m_read_requests)
+        read_request->visit_edges(visitor);
+    visitor.visit(m_stream);
+}
+
+class DefaultReaderReadRequest final : public ReadRequest {
+public:
+    DefaultReaderReadRequest(JS::Realm& realm, JS::NonnullGCPtr<JS::PromiseCapability> promise)
+        : m_realm(realm)
+        , m_promise(promise)
+    {
+    }
+
+    virtual void on_chunk(JS::Value chunk) override
+    {
+        // Resolve promise with «[ "value" → chunk, "done" → false ]».
+        WebIDL::resolve_promise(m_realm->vm(), *m_promise, JS::create_iterator_result_object(m_realm->vm(), chunk, false));
+    }
+
+    virtual void on_close() override
+    {
+        // Resolve promise with «[ "value" → undefined, "done" → true ]».
+        WebIDL::resolve_promise(m_realm->vm(), *m_promise, JS::create_iterator_result_object(m_realm->vm(), JS::js_undefined(), true));
+    }
+
+    virtual void on_error(JS::Value error) override
+    {
+        // Reject promise with e.
+        WebIDL::reject_promise(m_realm->vm(), *m_promise, error);
+    }
+
+    virtual void visit_edges(JS::Cell::Visitor& visitor) override
+    {
+        visitor.visit(m_realm);
+        visitor.visit(m_promise);
+    }
+
+private:
+    JS::NonnullGCPtr<JS::Realm> m_realm;
+    JS::NonnullGCPtr<JS::PromiseCapability> m_promise;
+};
+
+// https://streams.spec.whatwg.org/#default-reader-read
+JS::NonnullGCPtr<JS::Object> ReadableStreamDefaultReader::read()
+{
+    auto& realm = this->realm();
+
+    // 1. If this.[[stream]] is undefined, return a promise rejected with a TypeError exception.
+    if (!m_stream) {
+        auto exception = JS::TypeError::create(realm, "Cannot read from a released reader"sv);
+        return *WebIDL::create_rejected_promise(realm, exception)->promise();
+    }
+
+    // 2. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 3. Let readRequest be a new read request with the following items:
+    auto read_request = adopt_ref(*new DefaultReaderReadRequest(realm, promise));
+
+    // 4. Perform ! ReadableStreamDefaultReaderRead(this, readRequest).
+    readable_stream_default_reader_read(*this, move(read_request));
+
+    // 5. Return promise.
+    return *promise->promise();
+}
+
+// https://streams.spec.whatwg.org/#default-reader-release-lock
+void ReadableStreamDefaultReader::release_lock()
+{
+    // 1. If this.[[stream]] is undefined, return.
+    if (!m_stream)
+        return;
+
+    // 2. Perform ! ReadableStreamDefaultReaderRelease(this).
+    readable_stream_default_reader_release(*this);
+}
+
+// https://streams.spec.whatwg.org/#generic-reader-closed
+JS::GCPtr<JS::Object> ReadableStreamDefaultReader::closed()
+{
+    // 1. Return this.[[closedPromise]].
+    return m_closed_promise->promise();
+}
+
+// https://streams.spec.whatwg.org/#generic-reader-cancel
+JS::NonnullGCPtr<JS::Object> ReadableStreamDefaultReader::cancel(JS::Value reason)
+{
+    auto& realm = this->realm();
+
+    // 1. If this.[[stream]] is undefined, return a promise rejected with a TypeError exception.
+    if (!m_stream) {
+        auto exception = JS::TypeError::create(realm, "Cannot cancel a released reader"sv);
+        return *WebIDL::create_rejected_promise(realm, exception)->promise();
+    }
+
+    // 2. Return ! ReadableStreamReaderGenericCancel(this, reason).
+    return *readable_stream_reader_generic_cancel(*this, reason)->promise();
+}
+
+class ReadLoopReadRequest final : public ReadRequest {
+public:
+    ReadLoopReadRequest(JS::Realm& realm, ReadableStreamDefaultReader& reader, ReadableStreamDefaultReader::SuccessSteps success_steps, ReadableStreamDefaultReader::FailureSteps failure_steps)
+        : m_realm(realm)
+        , m_reader(reader)
+        , m_success_steps(move(success_steps))
+        , m_failure_steps(move(failure_steps))
+    {
+    }
+
+    // https://streams.spec.whatwg.org/#read-loop
+    void read_loop()
+    {
+        // NOTE: The spec reads the next chunk from within the chunk steps, which recurses once per chunk that is
+        //       already queued up. We loop here instead, and only start another read once the previous one returned.
+        if (m_is_reading) {
+            m_read_again = true;
+            return;
+        }
+
+        m_is_reading = true;
+        do {
+            m_read_again = false;
+
+            // 2. Perform ! ReadableStreamDefaultReaderRead(reader, readRequest).
+            readable_stream_default_reader_read(*m_reader, *this);
+        } while (m_read_again);
+        m_is_reading = false;
+    }
+
+    virtual void on_chunk(JS::Value chunk) override
+    {
+        // 1. If chunk is not a Uint8Array object, call failureSteps with a TypeError and abort these steps.
+        if (!chunk.is_object() || !is<JS::Uint8Array>(chunk.as_object())) {
+            m_failure_steps(JS::TypeError::create(*m_realm, "Chunk data is not a Uint8Array"sv));
+            return;
+        }
+
+        // 2. Append the bytes represented by chunk to bytes.
+        auto const& array = static_cast<JS::Uint8Array const&>(chunk.as_object());
+        if (m_bytes.try_append(array.data()).is_error()) {
+            m_failure_steps(JS::InternalError::create(*m_realm, "Out of memory while reading stream"sv));
+            return;
+        }
+
+        // 3. Read-loop given reader, bytes, successSteps, and failureSteps.
+        read_loop();
+    }
+
+    virtual void on_close() override
+    {
+        // Call successSteps with bytes.
+        m_success_steps(move(m_bytes));
+    }
+
+    virtual void on_error(JS::Value error) override
+    {
+        // Call failureSteps with e.
+        m_failure_steps(error);
+    }
+
+    virtual void visit_edges(JS::Cell::Visitor& visitor) override
+    {
+        visitor.visit(m_realm);
+        visitor.visit(m_reader);
+    }
+
+private:
+    JS::NonnullGCPtr<JS::Realm> m_realm;
+    JS::NonnullGCPtr<ReadableStreamDefaultReader> m_reader;
+    ByteBuffer m_bytes;
+    ReadableStreamDefaultReader::SuccessSteps m_success_steps;
+    ReadableStreamDefaultReader::FailureSteps m_failure_steps;
+    bool m_is_reading { false };
+    bool m_read_again { false };
+};
+
+// https://streams.spec.whatwg.org/#readablestreamdefaultreader-read-all-bytes
+void ReadableStreamDefaultReader::read_all_bytes(SuccessSteps success_steps, FailureSteps failure_steps)
+{
+    // To read all bytes from a ReadableStreamDefaultReader reader, given successSteps, which is an algorithm accepting
+    // a byte sequence, and failureSteps, which is an algorithm accepting a JavaScript value: read-loop given reader, a
+    // new byte sequence, successSteps, and failureSteps.
+    auto read_request = adopt_ref(*new ReadLoopReadRequest(realm(), *this, move(success_steps), move(failure_steps)));
+    read_request->read_loop();
+}
+
+}
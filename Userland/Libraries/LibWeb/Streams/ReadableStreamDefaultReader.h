@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/SafeFunction.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Streams/ReadableStream.h>
+
+namespace Web::Streams {
+
+// https://streams.spec.whatwg.org/#read-request
+class ReadRequest : public RefCounted<ReadRequest> {
+public:
+    virtual ~ReadRequest() = default;
+
+    virtual void on_chunk(JS::Value chunk) = 0;
+    virtual void on_close() = 0;
+    virtual void on_error(JS::Value error) = 0;
+
+    virtual void visit_edges(JS::Cell::Visitor&) { }
+};
+
+// https://streams.spec.whatwg.org/#readablestreamdefaultreader
+class ReadableStreamDefaultReader final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(ReadableStreamDefaultReader, Bindings::PlatformObject);
+
+public:
+    using SuccessSteps = JS::SafeFunction<void(ByteBuffer)>;
+    using FailureSteps = JS::SafeFunction<void(JS::Value error)>;
+
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<ReadableStreamDefaultReader>> construct_impl(JS::Realm&, ReadableStream&);
+
+    virtual ~ReadableStreamDefaultReader() override;
+
+    JS::NonnullGCPtr<JS::Object> read();
+    void release_lock();
+
+    JS::GCPtr<JS::Object> closed();
+    JS::NonnullGCPtr<JS::Object> cancel(JS::Value reason);
+
+    void read_all_bytes(SuccessSteps, FailureSteps);
+
+    JS::GCPtr<ReadableStream> stream() const { return m_stream; }
+    void set_stream(JS::GCPtr<ReadableStream> value) { m_stream = value; }
+
+    JS::GCPtr<JS::PromiseCapability> closed_promise_capability() const { return m_closed_promise; }
+    void set_closed_promise_capability(JS::GCPtr<JS::PromiseCapability> value) { m_closed_promise = value; }
+
+    Vector<NonnullRefPtr<ReadRequest>>& read_requests() { return m_read_requests; }
+    Vector<NonnullRefPtr<ReadRequest>> const& read_requests() const { return m_read_requests; }
+
+private:
+    explicit ReadableStreamDefaultReader(JS::Realm&);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://streams.spec.whatwg.org/#readablestreamgenericreader-closedpromise
+    // A promise returned by the reader's closed getter
+    JS::GCPtr<JS::PromiseCapability> m_closed_promise;
+
+    // https://streams.spec.whatwg.org/#readablestreamdefaultreader-readrequests
+    // A list of read requests, used when a consumer requests chunks sooner than they are available
+    Vector<NonnullRefPtr<ReadRequest>> m_read_requests;
+
+    // https://streams.spec.whatwg.org/#readablestreamgenericreader-stream
+    // A ReadableStream instance that owns this reader
+    JS::GCPtr<ReadableStream> m_stream;
+};
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/Performance.h>
+#include <LibWeb/UserTiming/PerformanceMark.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::UserTiming {
+
+bool is_performance_timing_attribute_name(StringView name)
+{
+    static constexpr Array attribute_names = {
+        "navigationStart"sv,
+        "unloadEventStart"sv,
+        "unloadEventEnd"sv,
+        "redirectStart"sv,
+        "redirectEnd"sv,
+        "fetchStart"sv,
+        "domainLookupStart"sv,
+        "domainLookupEnd"sv,
+        "connectStart"sv,
+        "connectEnd"sv,
+        "secureConnectionStart"sv,
+        "requestStart"sv,
+        "responseStart"sv,
+        "responseEnd"sv,
+        "domLoading"sv,
+        "domInteractive"sv,
+        "domContentLoadedEventStart"sv,
+        "domContentLoadedEventEnd"sv,
+        "domComplete"sv,
+        "loadEventStart"sv,
+        "loadEventEnd"sv,
+    };
+    return attribute_names.span().contains_slow(name);
+}
+
+// https://w3c.github.io/user-timing/#the-performancemark-constructor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<PerformanceMark>> PerformanceMark::construct_impl(JS::Realm& realm, DeprecatedString const& mark_name, PerformanceMarkOptions const& mark_options)
+{
+    auto& vm = realm.vm();
+    auto& window = verify_cast<HTML::Window>(realm.global_object());
+
+    // 1. If the current global object is a Window object and markName uses the same name as a read only attribute in the PerformanceTiming interface, throw a SyntaxError.
+    if (is_performance_timing_attribute_name(mark_name))
+        return WebIDL::SyntaxError::create(realm, DeprecatedString::formatted("'{}' is a PerformanceTiming attribute name", mark_name));
+
+    // 2. Create a new PerformanceMark object (entry) with the current global object's realm.
+    // 3. Set entry's name attribute to markName.
+    // 4. Set entry's entryType attribute to DOMString "mark".
+    // NOTE: These are done by the constructor.
+
+    // 5. Set entry's startTime attribute as follows:
+    double start_time = 0;
+    // 1. If markOptions's startTime member is present, then:
+    if (mark_options.start_time.has_value()) {
+        // 1. If markOptions's startTime is negative, throw a TypeError.
+        if (*mark_options.start_time < 0)
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "startTime must not be negative"sv };
+
+        // 2. Otherwise, set entry's startTime to the value of markOptions's startTime.
+        start_time = *mark_options.start_time;
+    }
+    // 2. Otherwise, set it to the value that would be returned by the Performance object's now() method.
+    else {
+        start_time = window.performance().now();
+    }
+
+    // 6. Set entry's duration attribute to 0.
+    // NOTE: This is done by the constructor.
+
+    // 7. If markOptions's detail is null, set entry's detail to null.
+    auto detail = JS::js_null();
+
+    // 8. Otherwise:
+    if (!mark_options.detail.is_null()) {
+        // 1. Let record be the result of calling the StructuredSerialize algorithm on markOptions's detail.
+        auto record = TRY(HTML::structured_serialize(vm, mark_options.detail));
+
+        // 2. Set entry's detail to the result of calling the StructuredDeserialize algorithm on record and the current realm.
+        detail = TRY(HTML::structured_deserialize(vm, record, realm, {}));
+    }
+
+    return realm.heap().allocate<PerformanceMark>(realm, realm, mark_name, start_time, detail);
+}
+
+PerformanceMark::PerformanceMark(JS::Realm& realm, DeprecatedString const& name, double start_time, JS::Value detail)
+    : PerformanceEntry(realm, name, "mark", start_time, 0)
+    , m_detail(detail)
+{
+    set_prototype(&Bindings::cached_web_prototype(realm, "PerformanceMark"));
+}
+
+PerformanceMark::~PerformanceMark() = default;
+
+void PerformanceMark::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_detail);
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::UserTiming {
+
+// https://w3c.github.io/user-timing/#performancemarkoptions-dictionary
+struct PerformanceMarkOptions {
+    JS::Value detail { JS::js_undefined() };
+    Optional<double> start_time;
+};
+
+// https://w3c.github.io/user-timing/#performancemark
+class PerformanceMark final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceMark, PerformanceTimeline::PerformanceEntry);
+
+public:
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<PerformanceMark>> construct_impl(JS::Realm&, DeprecatedString const& mark_name, PerformanceMarkOptions const& mark_options = {});
+
+    virtual ~PerformanceMark() override;
+
+    JS::Value detail() const { return m_detail; }
+
+private:
+    PerformanceMark(JS::Realm&, DeprecatedString const& name, double start_time, JS::Value detail);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    JS::Value m_detail { JS::js_null() };
+};
+
+bool is_performance_timing_attribute_name(StringView);
+
+}
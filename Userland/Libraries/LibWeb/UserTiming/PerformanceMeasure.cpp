@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/UserTiming/PerformanceMeasure.h>
+
+namespace Web::UserTiming {
+
+JS::NonnullGCPtr<PerformanceMeasure> PerformanceMeasure::create(JS::Realm& realm, DeprecatedString const& name, double start_time, double duration, JS::Value detail)
+{
+    return realm.heap().allocate<PerformanceMeasure>(realm, realm, name, start_time, duration, detail);
+}
+
+PerformanceMeasure::PerformanceMeasure(JS::Realm& realm, DeprecatedString const& name, double start_time, double duration, JS::Value detail)
+    : PerformanceEntry(realm, name, "measure", start_time, duration)
+    , m_detail(detail)
+{
+    set_prototype(&Bindings::cached_web_prototype(realm, "PerformanceMeasure"));
+}
+
+PerformanceMeasure::~PerformanceMeasure() = default;
+
+void PerformanceMeasure::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_detail);
+}
+
+}
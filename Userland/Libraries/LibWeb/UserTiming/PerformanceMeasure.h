@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::UserTiming {
+
+// https://w3c.github.io/user-timing/#performancemeasure
+class PerformanceMeasure final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceMeasure, PerformanceTimeline::PerformanceEntry);
+
+public:
+    static JS::NonnullGCPtr<PerformanceMeasure> create(JS::Realm&, DeprecatedString const& name, double start_time, double duration, JS::Value detail);
+
+    virtual ~PerformanceMeasure() override;
+
+    JS::Value detail() const { return m_detail; }
+
+private:
+    PerformanceMeasure(JS::Realm&, DeprecatedString const& name, double start_time, double duration, JS::Value detail);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    JS::Value m_detail { JS::js_null() };
+};
+
+}
@@ -161,9 +161,12 @@ libweb_js_bindings(HTML/WorkerNavigator)
 libweb_js_bindings(HighResolutionTime/Performance)
 libweb_js_bindings(IntersectionObserver/IntersectionObserver)
 libweb_js_bindings(NavigationTiming/PerformanceTiming)
+libweb_js_bindings(PerformanceTimeline/PerformanceEntry)
 libweb_js_bindings(RequestIdleCallback/IdleDeadline)
 libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(Streams/ReadableStream)
+libweb_js_bindings(Streams/ReadableStreamDefaultController)
+libweb_js_bindings(Streams/ReadableStreamDefaultReader)
 libweb_js_bindings(SVG/SVGAnimatedLength)
 libweb_js_bindings(SVG/SVGClipPathElement)
 libweb_js_bindings(SVG/SVGDefsElement)
@@ -189,6 +192,8 @@ libweb_js_bindings(UIEvents/UIEvent)
 libweb_js_bindings(UIEvents/WheelEvent)
 libweb_js_bindings(URL/URL)
 libweb_js_bindings(URL/URLSearchParams ITERABLE)
+libweb_js_bindings(UserTiming/PerformanceMark)
+libweb_js_bindings(UserTiming/PerformanceMeasure)
 libweb_js_bindings(WebGL/WebGLContextEvent)
 libweb_js_bindings(WebGL/WebGLRenderingContext)
 libweb_js_bindings(WebIDL/DOMException)
@@ -69,6 +69,16 @@ void RequestServerRequestAdapter::stream_into(Core::Stream::Stream& stream)
     m_request->stream_into(stream);
 }
 
+void RequestServerRequestAdapter::set_unbuffered_request_callbacks(HeadersReceived on_headers_received, DataReceived on_data_received, RequestFinished on_finish)
+{
+    m_request->set_unbuffered_request_callbacks(move(on_headers_received), move(on_data_received), move(on_finish));
+}
+
+void RequestServerRequestAdapter::set_reading_paused(bool paused)
+{
+    m_request->set_reading_paused(paused);
+}
+
 ErrorOr<NonnullRefPtr<RequestServerAdapter>> RequestServerAdapter::try_create()
 {
     auto protocol_client = TRY(Protocol::RequestClient::try_create());
@@ -29,6 +29,9 @@ public:
 
     virtual void stream_into(Core::Stream::Stream&) override;
 
+    virtual void set_unbuffered_request_callbacks(HeadersReceived, DataReceived, RequestFinished) override;
+    virtual void set_reading_paused(bool) override;
+
 private:
     RequestServerRequestAdapter(NonnullRefPtr<Protocol::Request>);
     NonnullRefPtr<Protocol::Request> m_request;
@@ -226,6 +226,11 @@ void ConnectionFromClient::debug_request(DeprecatedString const& request, Deprec
         }
     }
 
+    if (request == "dump-performance-counters") {
+        if (auto* doc = page().top_level_browsing_context().active_document())
+            doc->performance_recorder().dump();
+    }
+
     if (request == "collect-garbage") {
         Web::Bindings::main_thread_vm().heap().collect_garbage(JS::Heap::CollectionType::CollectGarbage, true);
     }
@@ -675,13 +675,13 @@ private:
     HeadlessWebSocketClientManager() { }
 };
 
-static void load_page_for_screenshot_and_exit(HeadlessBrowserPageClient& page_client, int take_screenshot_after)
+static NonnullRefPtr<Core::Timer> load_page_for_screenshot_and_exit(HeadlessBrowserPageClient& page_client, int take_screenshot_after, bool dump_performance_counters)
 {
     dbgln("Taking screenshot after {} seconds", take_screenshot_after);
 
     auto timer = Core::Timer::create_single_shot(
         take_screenshot_after * 1000,
-        [&]() {
+        [&page_client, dump_performance_counters]() {
             // FIXME: Allow passing the output path as argument
             DeprecatedString output_file_path = "output.png";
             dbgln("Saving to {}", output_file_path);
@@ -699,10 +699,16 @@ static void load_page_for_screenshot_and_exit(HeadlessBrowserPageClient& page_cl
             auto image_buffer = MUST(Gfx::PNGWriter::encode(output_bitmap));
             MUST(output_file->write(image_buffer.bytes()));
 
+            if (dump_performance_counters) {
+                if (auto* document = page_client.page().top_level_browsing_context().active_document())
+                    outln("{}", document->performance_recorder().to_json().to_deprecated_string());
+            }
+
             exit(0);
         });
 
     timer->start();
+    return timer;
 }
 
 ErrorOr<int> serenity_main(Main::Arguments arguments)
@@ -713,6 +719,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     StringView error_page_url;
     StringView ca_certs_path;
     StringView webdriver_ipc_path;
+    bool dump_performance_counters = false;
 
     Core::EventLoop event_loop;
     Core::ArgsParser args_parser;
@@ -722,6 +729,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(error_page_url, "URL for the error page (defaults to file:///res/html/error.html)", "error-page", 'e', "error-page-url");
     args_parser.add_option(ca_certs_path, "The bundled ca certificates file", "certs", 'c', "ca-certs-path");
     args_parser.add_option(webdriver_ipc_path, "Path to the WebDriver IPC socket", "webdriver-ipc-path", 0, "path");
+    args_parser.add_option(dump_performance_counters, "Print the page's performance counters as JSON after taking the screenshot", "dump-performance-counters", 0);
     args_parser.add_positional_argument(url, "URL to open", "url", Core::ArgsParser::Required::Yes);
     args_parser.parse(arguments);
 
@@ -769,10 +777,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     page_client->set_viewport_rect({ 0, 0, 800, 600 });
     page_client->set_screen_rect({ 0, 0, 800, 600 });
 
+    // NOTE: The screenshot timer has to be kept alive until the event loop exits, otherwise it never fires.
+    RefPtr<Core::Timer> timer;
     if (!webdriver_ipc_path.is_empty())
         TRY(page_client->connect_to_webdriver(webdriver_ipc_path));
     else
-        load_page_for_screenshot_and_exit(*page_client, take_screenshot_after);
+        timer = load_page_for_screenshot_and_exit(*page_client, take_screenshot_after, dump_performance_counters);
 
     return event_loop.exec();
 }
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/StandardPaths.h>
@@ -14,6 +15,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Console.h>
 #include <LibJS/Interpreter.h>
 #include <LibJS/Parser.h>
@@ -511,6 +513,18 @@ static ErrorOr<void> repl(JS::Interpreter& interpreter)
     return {};
 }
 
+static ErrorOr<void> write_sampling_profile(StringView path)
+{
+    auto profiler = g_vm->stop_sampling_profiler();
+    if (!profiler)
+        return {};
+
+    auto file = TRY(Core::Stream::File::open(path, Core::Stream::OpenMode::Write | Core::Stream::OpenMode::Truncate));
+    TRY(file->write_entire_buffer(profiler->to_cpuprofile_json().to_deprecated_string().bytes()));
+    warnln("Wrote {} profile samples to {}", profiler->sample_count(), path);
+    return {};
+}
+
 static Function<void()> interrupt_interpreter;
 static void sigint_handler()
 {
@@ -603,6 +617,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool gc_on_every_allocation = false;
     bool disable_syntax_highlight = false;
     StringView evaluate_script;
+    StringView profile_path;
+    u32 profile_interval_ms = 1;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -618,6 +634,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(gc_on_every_allocation, "GC on every allocation", "gc-on-every-allocation", 'g');
     args_parser.add_option(disable_syntax_highlight, "Disable live syntax highlighting", "no-syntax-highlight", 's');
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
+    args_parser.add_option(profile_path, "Write a sampling profile of the bytecode interpreter (.cpuprofile) to path", "profile", 0, "path");
+    args_parser.add_option(profile_interval_ms, "Sampling profiler interval in milliseconds (default: 1)", "profile-interval", 0, "ms");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -626,6 +644,19 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     g_vm = JS::VM::create();
     g_vm->enable_default_host_import_module_dynamically_hook();
 
+    if (!profile_path.is_empty()) {
+        if (!s_run_bytecode)
+            warnln("Warning: The sampling profiler only observes the bytecode interpreter, use --run-bytecode");
+        g_vm->start_sampling_profiler(Time::from_milliseconds(max(profile_interval_ms, 1u)));
+    }
+
+    ScopeGuard write_profile_guard = [&] {
+        if (profile_path.is_empty())
+            return;
+        if (auto result = write_sampling_profile(profile_path); result.is_error())
+            warnln("Failed to write profile to {}: {}", profile_path, result.error());
+    };
+
     // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -
     // which is, as far as I can tell, correct - a promise is created, rejected without handler, and a
     // handler then attached to it. The Node.js REPL doesn't warn in this case, so it's something we